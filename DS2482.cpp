@@ -3,21 +3,55 @@
 // started: Jan 21, 2022  G. D. (Joe) Young <jyoung@islandnet.com>
 //
 // revised: Feb 15/22 - subroutines for I2C i/o
+//          Oct 19/26 - calc_crc16
+//          Oct 19/26 - OWVerify
+//          Oct 19/26 - range-for search, OWTargetSetup, OWFamilySkipSetup
+//          Oct 19/26 - owwait uses status from command; bit block and poll
+//          Oct 19/26 - bridge discovery, channel select; crc table in PROGMEM
+//          Oct 19/26 - config shadow follows writes; suspend, resume
+//          Oct 19/26 - strong pullup writes keep APU, speed and masking
 //
 //
 
 #include "DS2482.h"
 #include <Wire.h>
 
+static const uint8_t dscrc_table[256] PROGMEM = {                 /* crc table */
+
+   0, 94,188,226, 97, 63,221,131,194,156,126, 32,163,253, 31, 65,
+  157,195, 33,127,252,162, 64, 30, 95,  1,227,189, 62, 96,130,220,
+  35,125,159,193, 66, 28,254,160,225,191, 93,  3,128,222, 60, 98,
+  190,224,  2, 92,223,129, 99, 61,124, 34,192,158, 29, 67,161,255,
+  70, 24,250,164, 39,121,155,197,132,218, 56,102,229,187, 89,  7,
+  219,133,103, 57,186,228,  6, 88, 25, 71,165,251,120, 38,196,154,
+  101, 59,217,135,  4, 90,184,230,167,249, 27, 69,198,152,122, 36,
+  248,166, 68, 26,153,199, 37,123, 58,100,134,216, 91,  5,231,185,
+  140,210, 48,110,237,179, 81, 15, 78, 16,242,172, 47,113,147,205,
+  17, 79,173,243,112, 46,204,146,211,141,111, 49,178,236, 14, 80,
+  175,241, 19, 77,206,144,114, 44,109, 51,209,143, 12, 82,176,238,
+  50,108,142,208, 83, 13,239,177,240,174, 76, 18,145,207, 45,115,
+  202,148,118, 40,171,245, 23, 73,  8, 86,180,234,105, 55,213,139,
+  87,  9,235,181, 54,104,138,212,149,203, 41,119,244,170, 72, 22,
+  233,183, 85, 11,136,214, 52,106, 43,117,151,201, 74, 20,246,168,
+  116, 42,200,150, 21, 75,169,247,182,232, 10, 84,215,137,107, 53
+
+};
+
 DS2482::DS2482( uint8_t _i2cAdr ) {
 	I2Cadr = (int)_i2cAdr;
+	c1WS = 0;		//DS2482_detect defaults until configured
+	cSPU = 0;
+	cPPM = 0;
+	cAPU = CONFIG_APU;
+	channels = 0;
+	channel = 0;
 }//constructor
 
 void DS2482::begin( ) {		//empty placeholder - may use if I2C is shared; setup restarting
 
 } //begin
 
-//these 4 functions collect all I2C i/o
+//these functions collect all I2C i/o
 
 uint8_t DS2482::owcmd( uint8_t cmd ){
 	Wire.beginTransmission( I2Cadr );
@@ -48,13 +82,36 @@ uint8_t DS2482::owcmdw( uint8_t cmd, uint8_t dat ) {
 }
 
 
+// write only, for commands to several bridges before reading any back
+// Returns: true if the bridge acknowledged
+bool DS2482::owsend( uint8_t cmd ) {
+	Wire.beginTransmission( I2Cadr );
+	Wire.write( cmd );
+	return Wire.endTransmission( ) == 0;
+} // owsend( cmd )
+
+bool DS2482::owsend( uint8_t cmd, uint8_t dat ) {
+	Wire.beginTransmission( I2Cadr );
+	Wire.write( cmd );
+	Wire.write( dat );
+	return Wire.endTransmission( ) == 0;
+} // owsend( cmd, arg )
+
+// read the register the last command left the read pointer on
+uint8_t DS2482::owread( ) {
+	Wire.requestFrom( (int)I2Cadr, (int)1 );
+	return Wire.read( );
+} // owread( )
+
+
+// the status read along with the command is the first poll - a short
+// command (single bit) is usually finished by then and needs no further read
 uint8_t DS2482::owwait( uint8_t status ) {
 	int8_t poll_count = 0;
-	do {
+	while( (status & 1<<(ST_1WB)) && (poll_count++ < POLL_LIMIT) ) {
 		Wire.requestFrom( I2Cadr, 1 );
-//		status = Wire.read( ) & 1<<(ST_1WB);
-    status = Wire.read( );                //keep all bits for further tests
-	} while( (status & 1<<(ST_1WB)) && (poll_count++ < POLL_LIMIT) );
+		status = Wire.read( );                //keep all bits for further tests
+	}
 	#ifdef DEBUG
 		Serial.print( " * status " );
 		Serial.println( status, HEX );
@@ -62,7 +119,7 @@ uint8_t DS2482::owwait( uint8_t status ) {
 		Serial.println( poll_count, DEC );
 	#endif
 	// check for failure due to poll limit reached
-	if (poll_count >= POLL_LIMIT)
+	if (status & 1<<(ST_1WB))
 	{
 		DS2482_reset();
 		return 0;
@@ -157,10 +214,152 @@ bool DS2482::DS2482_write_config(uint8_t config)
       return false;
    }
 
+   // keep the shadow - resume( ) restores it after a power-down
+   c1WS = config & 1<<(wWS);
+   cSPU = config & 1<<(SPU);
+   cPPM = config & 1<<(PPM);
+   cAPU = config & 1<<(APU);
+
    return true;
 }
 
 
+//--------------------------------------------------------------------------
+// Select the 1-Wire channel on a DS2482-800. Channel 0 is the only channel
+// of a DS2482-100 and is selected after a device reset.
+//
+// 'channel' - 0 to 7
+//
+// Returns:  true: channel selected and confirmed
+//           false: no such channel or wrong read back
+//
+bool DS2482::DS2482_channel_select( uint8_t channel )
+{
+	if( channel >= 8 ) return false;
+	// codes F0, E1 .. 87 read back as B8, B1 .. 87
+	uint8_t check = owcmd( CMD_CHSL, 0xF0 - channel * 0x0F );
+	if( check != 0xB8 - channel * 7 ) return false;
+	this->channel = channel;
+	return true;
+} //DS2482_channel_select( )
+
+//--------------------------------------------------------------------------
+// Find every DS2482 on the I2C bus and bring it up as DS2482_detect does.
+// Each step goes to all the bridges before any is read back, so a bridge
+// completes its reset or config write while the next is addressed:
+//   device reset to each address in DS2482_ADR_FIRST..LAST - acknowledge
+//     marks a bridge
+//   read the status of each - reset bit set
+//   select channel 0 on each - a DS2482-800 confirms, a -100 does not
+//   write default configuration to each, then read each back
+//
+// 'bridges'   - objects to set up, in address order; the default
+//               constructor address is replaced
+// 'maxbridge' - size of bridges[ ]
+//
+// Returns:  number of bridges ready for use
+//
+uint8_t DS2482::DS2482_discover( DS2482 *bridges, uint8_t maxbridge )
+{
+	uint8_t n = 0;
+	uint8_t kept;
+	uint8_t ix;
+
+	for( uint8_t adr = DS2482_ADR_FIRST; adr <= DS2482_ADR_LAST && n < maxbridge; adr++ ) {
+		bridges[n].I2Cadr = adr;
+		if( bridges[n].owsend( CMD_DRST ) ) n++;
+	}
+
+	for( ix=0, kept=0; ix<n; ix++ ) {
+		if( ( bridges[ix].owread( ) & 0xF7 ) == 0x10 ) bridges[kept++].I2Cadr = bridges[ix].I2Cadr;
+	}
+	n = kept;
+
+	for( ix=0; ix<n; ix++ ) bridges[ix].owsend( CMD_CHSL, 0xF0 );
+	for( ix=0; ix<n; ix++ ) {
+		bridges[ix].channels = ( bridges[ix].owread( ) == 0xB8 ) ? 8 : 1;
+		bridges[ix].channel = 0;
+	}
+
+	for( ix=0; ix<n; ix++ ) {
+		DS2482 &b = bridges[ix];
+		b.c1WS = 0;
+		b.cSPU = 0;
+		b.cPPM = 0;
+		b.cAPU = CONFIG_APU;
+		uint8_t config = b.c1WS | b.cSPU | b.cPPM | b.cAPU;
+		b.owsend( CMD_WCFG, config | ( ~config<<4 ) );
+	}
+	for( ix=0, kept=0; ix<n; ix++ ) {
+		DS2482 &b = bridges[ix];
+		if( b.owread( ) != ( b.c1WS | b.cSPU | b.cPPM | b.cAPU ) ) continue;
+		if( kept != ix ) bridges[kept] = b;
+		kept++;
+	}
+	return kept;
+} //DS2482_discover( )
+
+//--------------------------------------------------------------------------
+// Prepare for the bridge (and bus) to be powered down: release any strong
+// pullup and leave the read pointer on the status register, so resume( )
+// needs only a status read. Save the returned state if the processor does
+// not keep its RAM while asleep.
+//
+// Returns:  bridge state for resume( )
+//
+DS2482state DS2482::suspend( )
+{
+	if( cSPU ) OWLevel( MODE_STANDARD );
+	owsend( CMD_SRP, STATREG );
+
+	DS2482state state;
+	state.adr = I2Cadr;
+	state.config = c1WS | cPPM | cAPU;
+	state.channel = channel;
+	state.channels = channels;
+	return state;
+} //suspend( )
+
+//--------------------------------------------------------------------------
+// Bring the bridge back after suspend( ) with as little I2C traffic as the
+// bridge allows - no device reset or identification as in DS2482_detect:
+//   status read only, if the bridge kept power (RST clear)
+//   status read, config write and read back, channel select if not 0,
+//     if it was powered down (RST set)
+//   device reset first if the status shows it busy or absent
+//
+// Returns:  true: bridge configured as before suspend( )
+//           false: bridge missing or config not accepted
+//
+bool DS2482::resume( )
+{
+	uint8_t status = owread( );
+
+	if( status == 0xFF || ( status & 1<<(ST_1WB) ) ) {
+		if( !DS2482_reset( ) ) return false;
+		status = 1<<(ST_RST);
+	}
+	if( !( status & 1<<(ST_RST) ) ) return true;		//kept its state
+
+	if( !DS2482_write_config( c1WS | cPPM | cAPU ) ) return false;
+	if( channel != 0 && !DS2482_channel_select( channel ) ) return false;
+	return true;
+} //resume( )
+
+// resume from a state saved outside the object
+bool DS2482::resume( const DS2482state &state )
+{
+	I2Cadr = state.adr;
+	c1WS = state.config & 1<<(wWS);
+	cSPU = 0;
+	cPPM = state.config & 1<<(PPM);
+	cAPU = state.config & 1<<(APU);
+	channel = state.channel;
+	channels = state.channels;
+	return resume( );
+} //resume( state )
+
+
 //--------------------------------------------------------------------------
 // Reset all of the devices on the 1-Wire Net and return the result.
 //
@@ -281,6 +480,66 @@ uint8_t DS2482::OWTouchBit(uint8_t sendbit)
 } //OWTouchBit
 
 
+//--------------------------------------------------------------------------
+// Send a run of bits to the 1-Wire Net and return the bits read in the
+// same buffer - the bit-level counterpart of OWBlock. Bits are packed least
+// significant first, bit 0 of tran_buf[0] going first. Each bit is one
+// single-bit command with, normally, a single status read.
+//
+// 'tran_buf' - packed bits to send (1 for read slots), replaced by bits read
+// 'nbits'    - number of time slots
+// 'stop'     - 0 or 1: stop after the first slot that reads this value;
+//              -1 (default): run all 'nbits' slots
+//
+// Returns:  number of slots done; less than 'nbits' only when 'stop' matched
+//
+int DS2482::OWTouchBits( uint8_t *tran_buf, int nbits, int stop )
+{
+   int i;
+   uint8_t mask, status;
+
+   for (i = 0; i < nbits; i++)
+   {
+      mask = 1 << (i & 7);
+      status = owcmdw( CMD_1WSB, (tran_buf[i >> 3] & mask) ? 0x80 : 0x00 );
+      if (status & 1<<(ST_SBR))
+         tran_buf[i >> 3] |= mask;
+      else
+         tran_buf[i >> 3] &= (uint8_t)~mask;
+      if (stop >= 0 && ((status & 1<<(ST_SBR)) != 0) == (stop != 0))
+         return i + 1;
+   }
+   return nbits;
+} //OWTouchBits( )
+
+//--------------------------------------------------------------------------
+// Poll the 1-Wire Net with read slots until a slot reads 'value', e.g.
+// waiting for a DS18B20 conversion to finish (reads 1 when done). Slots are
+// issued a byte (8 slots) per command, so each check costs one read-byte
+// command instead of eight single-bit commands.
+//
+// 'value'      - bit value to wait for, 0 or 1
+// 'timeout_ms' - give up after this long
+//
+// Returns:  true: 'value' was read
+//           false: timeout
+//
+bool DS2482::OWPollBit( uint8_t value, unsigned int timeout_ms )
+{
+   unsigned long start = millis();
+   uint8_t idle = value ? 0x00 : 0xFF;   // byte read while still waiting
+
+   do
+   {
+      if (OWReadByte() != idle)
+         return true;
+   }
+   while (millis() - start < timeout_ms);
+
+   return false;
+} //OWPollBit( )
+
+
 //--------------------------------------------------------------------------
 // Send 8 bits of communication to the 1-Wire Net and verify that the
 // 8 bits read from the 1-Wire Net are the same (write operation).
@@ -435,6 +694,115 @@ bool DS2482::OWNext()
    return OWSearch();
 }
 
+//--------------------------------------------------------------------------
+// Setup the search to find the device type 'family_code' on the next call
+// to OWNext() if it is present (AN187).
+//
+void DS2482::OWTargetSetup( uint8_t family_code )
+{
+   int i;
+
+   // set the search state to find SearchFamily type devices
+   ROM_NO[0] = family_code;
+   for (i = 1; i < 8; i++)
+      ROM_NO[i] = 0;
+   LastDiscrepancy = 64;
+   LastFamilyDiscrepancy = 0;
+   LastDeviceFlag = false;
+}
+
+//--------------------------------------------------------------------------
+// Setup the search to skip the current device type on the next call
+// to OWNext() (AN187).
+//
+void DS2482::OWFamilySkipSetup( )
+{
+   // set the Last discrepancy to last family discrepancy
+   LastDiscrepancy = LastFamilyDiscrepancy;
+   LastFamilyDiscrepancy = 0;
+
+   // check for end of list
+   if (LastDiscrepancy == 0)
+      LastDeviceFlag = true;
+}
+
+// forget any search in progress - next OWNext( ) acts as OWFirst( )
+void DS2482::OWSearchClear( )
+{
+   LastDiscrepancy = 0;
+   LastDeviceFlag = false;
+   LastFamilyDiscrepancy = 0;
+}
+
+//--------------------------------------------------------------------------
+// Range over the devices on the 1-Wire network, for use as
+//    for( const owrom &rom : i2ow.search( 0x28 ) ) { ... }
+// The search runs lazily, one device per loop pass, and stops as soon as
+// the family changes; leaving the loop early clears the search state.
+//
+// 'family_code' - only devices of this family; 0 for all devices
+//
+OWSearchRange DS2482::search( uint8_t family_code )
+{
+   return OWSearchRange( *this, family_code );
+}
+
+//--------------------------------------------------------------------------
+// Verify the device with the ROM number 'rom' is present on the 1-Wire
+// network (AN187). The search is forced down the path of 'rom', so it costs
+// one reset and 64 triplets rather than a full enumeration. The search state
+// and ROM_NO are restored afterwards, so a search in progress is unaffected.
+//
+// 'rom' - 8 byte ROM number to look for
+//
+// Returns:  true : device present
+//           false : device not found
+//
+bool DS2482::OWVerify( const uint8_t *rom )
+{
+   uint8_t rom_backup[8];
+   int i, ld_backup, lfd_backup;
+   bool rslt, ldf_backup;
+
+   // keep a backup copy of the current state
+   for (i = 0; i < 8; i++)
+      rom_backup[i] = ROM_NO[i];
+   ld_backup = LastDiscrepancy;
+   ldf_backup = LastDeviceFlag;
+   lfd_backup = LastFamilyDiscrepancy;
+
+   // set search to find the same device
+   for (i = 0; i < 8; i++)
+      ROM_NO[i] = rom[i];
+   LastDiscrepancy = 64;
+   LastDeviceFlag = false;
+
+   if (OWSearch())
+   {
+      // check if same device found
+      rslt = true;
+      for (i = 0; i < 8; i++)
+      {
+         if (rom[i] != ROM_NO[i])
+         {
+            rslt = false;
+            break;
+         }
+      }
+   }
+   else
+     rslt = false;
+
+   // restore the search state
+   for (i = 0; i < 8; i++)
+      ROM_NO[i] = rom_backup[i];
+   LastDiscrepancy = ld_backup;
+   LastDeviceFlag = ldf_backup;
+   LastFamilyDiscrepancy = lfd_backup;
+
+   return rslt;
+} //OWVerify( )
+
 //--------------------------------------------------------------------------
 // The 'OWSearch' function does a general search. This function
 // continues from the previous search state. The search state
@@ -596,10 +964,26 @@ uint8_t DS2482::DS2482_search_triplet(int search_direction)
 
 // calculate crc8
 uint8_t DS2482::calc_crc8( uint8_t &rombyte ) {
-  crc8 = dscrc_table[crc8 ^ rombyte ];
+  crc8 = pgm_read_byte( &dscrc_table[crc8 ^ rombyte ] );
   return crc8;
 }
 
+// calculate crc16 - one step of the 1-wire CRC16 (x^16 + x^15 + x^2 + 1) used
+// by switches and memory devices. Start from 0; a block followed by its
+// inverted CRC16 (as the devices send it) leaves the residue 0xB001.
+static const uint8_t oddparity[16] = { 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0 };
+
+uint16_t DS2482::calc_crc16( uint16_t crc16, uint8_t data ) {
+  uint16_t cdata = ( data ^ ( crc16 & 0xff ) ) & 0xff;
+  crc16 >>= 8;
+  if( oddparity[cdata & 0x0f] ^ oddparity[cdata >> 4] ) crc16 ^= 0xc001;
+  cdata <<= 6;
+  crc16 ^= cdata;
+  cdata <<= 1;
+  crc16 ^= cdata;
+  return crc16;
+}
+
 
 //--------------------------------------------------------------------------
 // Set the 1-Wire Net line level pullup to normal. The DS2482 only
@@ -621,8 +1005,8 @@ uint8_t DS2482::OWLevel(uint8_t new_level)
    // clear the strong pullup bit in the global config state
    cSPU = 0;
 
-   // write the new config
-   DS2482_write_config( MODE_STANDARD );   //clear strong pullup, set active pullup 
+   // write the new config - strong pullup off, rest as configured
+   DS2482_write_config( c1WS | cPPM | cAPU );
 
    return MODE_STANDARD;
 } //OWLevel( )
@@ -643,11 +1027,9 @@ int DS2482::OWReadBitPower(int applyPowerResponse)
 {
    uint8_t rdbit;
 
-   // set strong pullup enable
-   cSPU = 1<<(SPU);
-
-   // write the new config
-   if (!DS2482_write_config( cSPU ))
+   // set strong pullup enable; speed, masking and active pullup kept, so
+   // they are still set when the bridge clears SPU at the next command
+   if (!DS2482_write_config( c1WS | cPPM | cAPU | 1<<(SPU) ))
       return false;
 
    // perform read bit
@@ -676,11 +1058,9 @@ int DS2482::OWReadBitPower(int applyPowerResponse)
 //
 int DS2482::OWWriteBytePower(int sendbyte)
 {
-   // set strong pullup enable
-   cSPU = 1<<(SPU);
-
-   // write the new config
-   if (!DS2482_write_config(cSPU))
+   // set strong pullup enable; speed, masking and active pullup kept, so
+   // they are still set when the bridge clears SPU at the next command
+   if (!DS2482_write_config( c1WS | cPPM | cAPU | 1<<(SPU) ))
       return false;
 
    // perform write byte
@@ -691,3 +1071,49 @@ int DS2482::OWWriteBytePower(int sendbyte)
 
 
 
+
+
+OWSearchIter::OWSearchIter( DS2482 *bridge, uint8_t family_code ) {
+	ow = bridge;
+	family = family_code;
+}//constructor
+
+// advance - a finished search or a device outside the family ends the range
+OWSearchIter &OWSearchIter::operator++( ) {
+	found( ow->OWNext( ) );
+	return *this;
+} //operator++
+
+void OWSearchIter::found( bool ok ) {
+	if( ok && ( family == 0 || ow->ROM_NO[0] == family ) ) return;
+	ow->OWSearchClear( );
+	ow = NULL;
+} //found( )
+
+
+OWSearchRange::OWSearchRange( DS2482 &bridge, uint8_t family_code ) {
+	ow = &bridge;
+	family = family_code;
+}//constructor
+
+OWSearchRange::OWSearchRange( OWSearchRange &&other ) {
+	ow = other.ow;
+	family = other.family;
+	other.ow = NULL;
+}//move constructor
+
+OWSearchRange::~OWSearchRange( ) {
+	if( ow ) ow->OWSearchClear( );
+}//destructor
+
+// start the search - jumps straight to the family when one is given
+OWSearchIter OWSearchRange::begin( ) {
+	OWSearchIter it( ow, family );
+	if( family ) {
+		ow->OWTargetSetup( family );
+		it.found( ow->OWNext( ) );
+	} else {
+		it.found( ow->OWFirst( ) );
+	}
+	return it;
+} //begin( )
@@ -4,6 +4,15 @@
 //
 // Revised: Feb  1/22 - make calc_crc8 public
 //          Feb 15/22 - subroutines for I2C i/o
+//          Oct 19/26 - add calc_crc16 for devices with CRC16 checkpoints
+//          Oct 19/26 - add OWVerify
+//          Oct 19/26 - range-for search, OWTargetSetup, OWFamilySkipSetup
+//          Oct 19/26 - script interpreter shares config shadow and crc8
+//          Oct 19/26 - OWTouchBits, OWPollBit
+//          Oct 19/26 - bridge discovery, DS2482-800 channel select; crc
+//                      table in PROGMEM so bridges can be arrays
+//          Oct 19/26 - suspend/resume with cached bridge state
+//          Oct 19/26 - strong pullup writes keep APU, speed and masking
 //
 //
 // A library of functions from Dallas/Maxim Application Note AN3684, altered to
@@ -32,9 +41,15 @@
 #define CMD_WWBP 0x44   //one-wire write byte power
 #define CMD_SRP  0xE1   //set read pointer
 #define CMD_1WT  0x78   //one-wire triplet
+#define CMD_CHSL 0xC3   //channel select (DS2482-800)
 
 #define POLL_LIMIT 10     //number of times to check status of reset
 
+//DS2482 I2C address range - AD0..AD2 pins (-800), AD0..AD1 (-100)
+#define DS2482_ADR_FIRST 0x18
+#define DS2482_ADR_LAST 0x1F
+#define DS2482_MAXBRIDGE 8
+
 //DS2482 status register bit number names
 #define ST_1WB 0  //1WB one-wire busy
 #define ST_PPD 1     //presence pulse detect
@@ -48,6 +63,7 @@
 //cofiguration settings - register bit number names
 #define CONFIG_APU 1    //active pullup enabled
 #define APU 0       //active pull-up enabled when 1
+#define PPM 1       //presence pulse masking when 1
 #define SPU 2       //strong pull-up enabled when 1
 #define wWS 3       //1WS in data sheet; 1-wire speed fast when 1
 #define MODE_STANDARD 0x01  //APU bit ON
@@ -57,23 +73,47 @@
 //#define DEBUG
 #include <Arduino.h>
 
+typedef uint8_t owrom[8];      //one-wire ROM number, family code first
+
+// bridge state kept over a power-down, from suspend( ) for resume( )
+struct DS2482state {
+	uint8_t adr;        //I2C address
+	uint8_t config;     //configuration last written, strong pullup off
+	uint8_t channel;    //selected channel
+	uint8_t channels;   //1 or 8, 0 if not identified
+};
+
+class OWSearchRange;
+
 class DS2482 {
 
 public:
-	DS2482( uint8_t _i2cAdr );				//constructor receives DS2482 I2C address
+	DS2482( uint8_t _i2cAdr = DS2482_ADR_FIRST );		//constructor receives DS2482 I2C address
 	void begin( );
 
 	bool DS2482_reset();
 	bool DS2482_detect( );
 	bool DS2482_write_config(uint8_t config);
+	bool DS2482_channel_select( uint8_t channel );
+	static uint8_t DS2482_discover( DS2482 *bridges, uint8_t maxbridge );
+	uint8_t address( ) { return I2Cadr; }
+	DS2482state suspend( );
+	bool resume( );
+	bool resume( const DS2482state &state );
 	bool OWReset( );
 	uint8_t OWTouchBit(uint8_t sendbit);
 	uint8_t OWTouchByte(uint8_t sendbyte);
 	bool OWSearch();
 	bool OWFirst( );
 	bool OWNext();
+	bool OWVerify( const uint8_t *rom );
+	void OWTargetSetup( uint8_t family_code );
+	void OWFamilySkipSetup( );
+	OWSearchRange search( uint8_t family_code = 0 );	//for( const auto &rom : search( ) )
 	void OWWriteBit(uint8_t sendbit);
 	uint8_t OWReadBit(void);
+	int OWTouchBits( uint8_t *tran_buf, int nbits, int stop = -1 );
+	bool OWPollBit( uint8_t value, unsigned int timeout_ms );
 	void OWWriteByte(uint8_t sendbyte);
 	uint8_t OWReadByte(void);
 	void OWBlock(uint8_t *tran_buf, int tran_len);
@@ -83,14 +123,21 @@ public:
 	uint8_t OWLevel(uint8_t new_level);
 
 	bool short_detected;
+	uint8_t channels;	//1: DS2482-100, 8: DS2482-800, 0: not identified
+	uint8_t channel;	//selected channel
 	uint8_t ROM_NO[8];
 	uint8_t calc_crc8( uint8_t &rombyte );
+	static uint16_t calc_crc16( uint16_t crc16, uint8_t data );
 
 private:
+	friend class DS2482script;
 	int I2Cadr;
 	uint8_t c1WS,cSPU,cPPM,cAPU;
 
 // Search state
+	friend class OWSearchIter;
+	friend class OWSearchRange;
+	void OWSearchClear( );
 	int LastDiscrepancy;
 	int LastFamilyDiscrepancy;
 	bool LastDeviceFlag;
@@ -102,30 +149,51 @@ private:
 	uint8_t owcmdw( uint8_t cmd );
 	uint8_t owcmdw( uint8_t cmd, uint8_t dat );
 	uint8_t owwait( uint8_t status );
+	bool owsend( uint8_t cmd );
+	bool owsend( uint8_t cmd, uint8_t dat );
+	uint8_t owread( );
 
-	const uint8_t dscrc_table[256] = {                 /* crc table */
 
-   0, 94,188,226, 97, 63,221,131,194,156,126, 32,163,253, 31, 65,
-  157,195, 33,127,252,162, 64, 30, 95,  1,227,189, 62, 96,130,220,
-  35,125,159,193, 66, 28,254,160,225,191, 93,  3,128,222, 60, 98,
-  190,224,  2, 92,223,129, 99, 61,124, 34,192,158, 29, 67,161,255,
-  70, 24,250,164, 39,121,155,197,132,218, 56,102,229,187, 89,  7,
-  219,133,103, 57,186,228,  6, 88, 25, 71,165,251,120, 38,196,154,
-  101, 59,217,135,  4, 90,184,230,167,249, 27, 69,198,152,122, 36,
-  248,166, 68, 26,153,199, 37,123, 58,100,134,216, 91,  5,231,185,
-  140,210, 48,110,237,179, 81, 15, 78, 16,242,172, 47,113,147,205,
-  17, 79,173,243,112, 46,204,146,211,141,111, 49,178,236, 14, 80,
-  175,241, 19, 77,206,144,114, 44,109, 51,209,143, 12, 82,176,238,
-  50,108,142,208, 83, 13,239,177,240,174, 76, 18,145,207, 45,115,
-  202,148,118, 40,171,245, 23, 73,  8, 86,180,234,105, 55,213,139,
-  87,  9,235,181, 54,104,138,212,149,203, 41,119,244,170, 72, 22,
-  233,183, 85, 11,136,214, 52,106, 43,117,151,201, 74, 20,246,168,
-  116, 42,200,150, 21, 75,169,247,182,232, 10, 84,215,137,107, 53
+}; //class DS2482
 
-	};
 
+// Iterator for range-for over search results. Each step is one OWSearch, run
+// only when the loop asks for the next ROM; the ROM is ROM_NO itself, not a
+// copy. Compares equal to end once the search is done or leaves the family.
+class OWSearchIter {
 
-}; //class DS2482
+public:
+	OWSearchIter( DS2482 *bridge, uint8_t family_code );	//NULL bridge - end
+	const owrom &operator*( ) const { return ow->ROM_NO; }
+	OWSearchIter &operator++( );
+	bool operator!=( const OWSearchIter &other ) const { return ow != other.ow; }
+
+private:
+	friend class OWSearchRange;
+	DS2482 *ow;
+	uint8_t family;
+	void found( bool ok );
+
+}; //class OWSearchIter
+
+// Range returned by DS2482::search( ). Leaving the loop early (break, return)
+// clears the search state, so the next search starts from the top.
+class OWSearchRange {
+
+public:
+	OWSearchRange( DS2482 &bridge, uint8_t family_code );
+	OWSearchRange( OWSearchRange &&other );
+	~OWSearchRange( );
+	OWSearchIter begin( );
+	OWSearchIter end( ) { return OWSearchIter( NULL, family ); }
+
+private:
+	DS2482 *ow;
+	uint8_t family;
+	OWSearchRange( const OWSearchRange & );
+	OWSearchRange &operator=( const OWSearchRange & );
+
+}; //class OWSearchRange
 
 #endif
 
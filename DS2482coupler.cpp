@@ -0,0 +1,217 @@
+//DS2482coupler.cpp - DS2409 branch tree discovery and switching
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - complete( ) - no coupler output left without a branch
+//          Oct 19/26 - allOff( ) uses skip ROM only on a couplers-only trunk
+//
+//
+
+#include "DS2482coupler.h"
+#include "DS2482family.h"
+
+DS2482coupler::DS2482coupler( DS2482 &bridge, owbranch *branches, uint8_t _maxbr ) : ow( bridge ) {
+	br = branches;
+	maxbr = _maxbr;
+	count = 1;
+	dropped = false;
+	br[OWB_TRUNK].parent = OWB_NONE;
+	active = OWB_NONE;
+}//constructor
+
+
+//--------------------------------------------------------------------------
+// Walk the coupler tree from the trunk: connect each branch in turn, switch
+// off any couplers on it left on from before - on the trunk too, as allOff( )
+// only reaches couplers already in its table - then fill the branch table
+// and add branches for the couplers found. Branches and handles already
+// known keep their numbers, so discover( ) can be repeated. A coupler
+// output found with the branch table full is left out and complete( )
+// reports false until a later discover( ) finds room for it.
+//
+// Returns:  number of branches, trunk included
+//
+uint8_t DS2482coupler::discover( ) {
+	uint8_t rom[8];
+
+	dropped = false;
+	allOff( );
+	for( uint8_t b=0; b<count; b++ ) {
+		if( !select( b ) ) continue;			//coupler gone
+		DS2482table *t = br[b].tab;
+
+		for( const auto &found : ow.search( DS2409_FAMILY ) ) {
+			if( t->inUpstream( found ) ) continue;	//on the active path
+			for( uint8_t kx=0; kx<8; kx++ ) rom[kx] = found[kx];
+			command( rom, CPL_OFF );
+		}
+
+		t->discover( ow );
+		for( uint8_t ix=0; ix<t->count; ix++ ) {
+			if( t->dev[ix].flags & OWD_GONE ) continue;
+			if( DS2482family::driver( t->dev[ix].rom[0] ) != OWDRV_COUPLER ) continue;
+			if( !addBranch( b, ix, CPL_MAIN ) ) dropped = true;
+			if( !addBranch( b, ix, CPL_AUX ) ) dropped = true;
+		}
+	}
+	select( OWB_TRUNK );
+	return count;
+} //discover( )
+
+//--------------------------------------------------------------------------
+// Connect a branch. Couplers on the active path that are not on the new
+// one are switched off deepest first, then the new path is switched on
+// from the top; a coupler changing from one output to the other takes a
+// single smart-on. Nothing is sent when the branch is already connected.
+//
+// 'branch' - branch number, OWB_TRUNK for the bridge's own bus
+//
+// Returns:  true: branch connected
+//           false: no such branch or a coupler did not confirm; the
+//                  switch state is then unknown and rebuilt next time
+//
+bool DS2482coupler::select( uint8_t branch ) {
+	if( branch >= count ) return false;
+	if( branch == active ) return true;
+	if( active == OWB_NONE && !allOff( ) && branch != OWB_TRUNK ) return false;
+
+	// back up the active path to a branch on the wanted one
+	while( !onPath( active, branch ) ) {
+		uint8_t up = br[active].parent;
+		bool sibling = up != branch && onPath( up, branch ) && br[below( up, branch )].coupler == br[active].coupler;
+		if( !sibling && !command( couplerRom( active ), CPL_OFF ) ) {
+			active = OWB_NONE;
+			return false;
+		}
+		active = up;
+	}
+
+	// then down to the wanted branch
+	while( active != branch ) {
+		uint8_t next = below( active, branch );
+		if( !command( couplerRom( next ), br[next].channel ) ) {
+			active = OWB_NONE;
+			return false;
+		}
+		active = next;
+	}
+	return true;
+} //select( )
+
+// Returns: branch whose table holds 'rom', -1 if in none
+int DS2482coupler::branchOf( const uint8_t *rom ) {
+	for( uint8_t b=0; b<count; b++ ) {
+		if( br[b].tab->find( rom ) >= 0 ) return b;
+	}
+	return -1;
+} //branchOf( )
+
+//--------------------------------------------------------------------------
+// Connect the branch a device is on, ready for OWReset and match ROM.
+//
+// Returns:  branch number, -1 if the device is unknown or the switch failed
+//
+int DS2482coupler::selectDevice( const uint8_t *rom ) {
+	int b = branchOf( rom );
+	if( b < 0 || !select( b ) ) return -1;
+	return b;
+} //selectDevice( )
+
+// Returns: true if the last discover( ) found a branch for every coupler
+//          output, false if one was dropped for lack of room
+bool DS2482coupler::complete( ) const {
+	return !dropped;
+} //complete( )
+
+//--------------------------------------------------------------------------
+// Switch off the couplers on the trunk, leaving the trunk connected.
+// Couplers further down are unreachable once their trunk coupler is off.
+// When the trunk table is complete( ) and lists couplers only, one skip ROM
+// All Lines Off reaches them all and their confirmations are alike, so one
+// read checks them. Otherwise skip ROM could reach other devices and their
+// replies would mask a coupler that failed, so each coupler in the table is
+// sent All Lines Off by match ROM.
+//
+// Returns:  true: confirmed by every coupler addressed, at least one
+//           false: no presence, no coupler known or one did not confirm
+//
+bool DS2482coupler::allOff( ) {
+	DS2482table *t = br[OWB_TRUNK].tab;
+	uint8_t n = 0;
+	bool others = false, ok = true;
+
+	active = OWB_TRUNK;
+	for( uint8_t ix=0; ix<t->count; ix++ ) {
+		if( t->dev[ix].flags & OWD_GONE ) continue;
+		if( DS2482family::driver( t->dev[ix].rom[0] ) == OWDRV_COUPLER ) n++;
+		else others = true;
+	}
+	if( t->complete( ) && n > 0 && !others ) {
+		if( !ow.OWReset( ) ) return false;
+		ow.OWWriteByte( 0xCC );			//skip ROM - couplers only
+		ow.OWWriteByte( CPL_OFF );
+		return ow.OWReadByte( ) == CPL_OFF;	//all confirm alike
+	}
+
+	// match ROM - trunk has other devices or is not fully known
+	for( uint8_t ix=0; ix<t->count; ix++ ) {
+		if( t->dev[ix].flags & OWD_GONE ) continue;
+		if( DS2482family::driver( t->dev[ix].rom[0] ) != OWDRV_COUPLER ) continue;
+		if( !command( t->dev[ix].rom, CPL_OFF ) ) ok = false;
+	}
+	return ok && n > 0;
+} //allOff( )
+
+
+// true if 'anc' is 'branch' or above it
+bool DS2482coupler::onPath( uint8_t anc, uint8_t branch ) {
+	for( uint8_t b = branch; b != OWB_NONE; b = br[b].parent ) {
+		if( b == anc ) return true;
+	}
+	return false;
+} //onPath( )
+
+// Returns: branch on the path to 'branch' directly below 'anc'
+uint8_t DS2482coupler::below( uint8_t anc, uint8_t branch ) {
+	while( br[branch].parent != anc ) branch = br[branch].parent;
+	return branch;
+} //below( )
+
+// new branch for a coupler output unless already known
+// Returns: false if there was no room for it
+bool DS2482coupler::addBranch( uint8_t parent, uint8_t coupler, uint8_t channel ) {
+	for( uint8_t b=1; b<count; b++ ) {
+		if( br[b].parent == parent && br[b].coupler == coupler && br[b].channel == channel ) return true;
+	}
+	if( count >= maxbr ) return false;
+	br[count].parent = parent;
+	br[count].coupler = coupler;
+	br[count].channel = channel;
+	br[count].tab->upstream = br[parent].tab;
+	count++;
+	return true;
+} //addBranch( )
+
+//--------------------------------------------------------------------------
+// Send a DS2409 command to one coupler and check its confirmation byte.
+// A smart-on is followed by the reset stimulus and presence byte before
+// the confirmation; an empty branch still confirms.
+//
+// Returns:  true: command confirmed
+//
+bool DS2482coupler::command( const uint8_t *rom, uint8_t cmd ) {
+	uint8_t buf[3] = { 0xFF, 0xFF, 0xFF };
+	uint8_t n = ( cmd == CPL_OFF ) ? 1 : 3;
+
+	if( !ow.OWReset( ) ) return false;
+	ow.OWWriteByte( 0x55 );			//match ROM
+	for( uint8_t kx=0; kx<8; kx++ ) ow.OWWriteByte( rom[kx] );
+	ow.OWWriteByte( cmd );
+	ow.OWBlock( buf, n );
+	return buf[n-1] == cmd;
+} //command( )
+
+// Returns: ROM of the coupler that switches 'branch'
+const uint8_t *DS2482coupler::couplerRom( uint8_t branch ) {
+	return br[br[branch].parent].tab->dev[br[branch].coupler].rom;
+} //couplerRom( )
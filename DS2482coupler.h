@@ -0,0 +1,83 @@
+// DS2482coupler.h - DS2409 MicroLAN coupler branches with a device table each
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised: Oct 19/26 - complete( )
+//          Oct 19/26 - allOff( ) skip ROM only on a couplers-only trunk
+//
+//
+// A DS2409 coupler on the trunk switches one of its two outputs - main or
+// auxiliary - onto the bus, and couplers on a branch switch branches of
+// their own, so a large network becomes a tree of short segments. Only the
+// segment in use is connected, so resets and slots see less capacitance
+// and a search walks only that segment's ROMs (plus the trunk's, which is
+// always connected - keep the trunk to couplers where possible; allOff( )
+// then switches them all off with one skip ROM command rather than one
+// match ROM command per coupler).
+//
+// discover( ) walks the tree from the trunk, filling one DS2482table per
+// branch; a branch table holds only the devices behind its coupler output.
+// select( ) connects a branch, sending coupler commands only where the
+// active path and the wanted one differ - none when the branch is already
+// connected. A coupler output found once all 'maxbr' branches are in use
+// gets no branch; complete( ) is then false after discover( ). Branch
+// storage and the tables are supplied by the sketch:
+//
+//   owdevice trunkdev[4], b1dev[8], b2dev[8];
+//   DS2482table trunk( trunkdev, 4 ), b1( b1dev, 8 ), b2( b2dev, 8 );
+//   owbranch branches[] = { { &trunk }, { &b1 }, { &b2 } };
+//   DS2482coupler net( i2ow, branches, 3 );
+//
+#ifndef DS2482_COUPLER_HDR
+#define DS2482_COUPLER_HDR
+
+#include "DS2482.h"
+#include "DS2482table.h"
+
+#define DS2409_FAMILY 0x1F  //MicroLAN coupler
+
+//DS2409 function commands
+#define CPL_MAIN 0xCC       //smart-on main
+#define CPL_AUX 0x33        //smart-on auxiliary
+#define CPL_OFF 0x66        //all lines off
+
+#define OWB_TRUNK 0         //branch number of the bridge's own bus
+#define OWB_NONE 0xFF       //no parent; switch state unknown
+
+struct owbranch {
+	DS2482table *tab;   //devices on the branch
+	uint8_t parent;     //branch the coupler is on
+	uint8_t coupler;    //coupler's handle in the parent's table
+	uint8_t channel;    //CPL_MAIN or CPL_AUX
+};
+
+class DS2482coupler {
+
+public:
+	DS2482coupler( DS2482 &bridge, owbranch *branches, uint8_t _maxbr );	//storage from caller
+
+	uint8_t discover( );
+	bool select( uint8_t branch );
+	int branchOf( const uint8_t *rom );
+	int selectDevice( const uint8_t *rom );
+	bool allOff( );
+	bool complete( ) const;	//last discover( ) had room for every branch
+
+	owbranch *br;
+	uint8_t count;		//branches in use, trunk included
+	uint8_t active;		//connected branch, OWB_NONE if unknown
+
+private:
+	DS2482 &ow;
+	uint8_t maxbr;
+	bool dropped;		//coupler output found with no branch free
+
+	bool onPath( uint8_t anc, uint8_t branch );
+	uint8_t below( uint8_t anc, uint8_t branch );
+	bool addBranch( uint8_t parent, uint8_t coupler, uint8_t channel );
+	bool command( const uint8_t *rom, uint8_t cmd );
+	const uint8_t *couplerRom( uint8_t branch );
+
+}; //class DS2482coupler
+
+#endif
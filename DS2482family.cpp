@@ -0,0 +1,131 @@
+//DS2482family.cpp - compile-time family code table and direct index
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised:
+//
+//
+// The registry is written once, as OWFAMILY_LIST below; the descriptions,
+// the entry table and the code-to-entry index are all generated from it.
+// To add a family, add one OWFAM line.
+//
+
+#include "DS2482family.h"
+
+#define PP  OWC_PARASITE
+#define OD  OWC_OVERDRIVE
+
+//      code  capabilities                 driver         memory  description
+#define OWFAMILY_LIST \
+OWFAM( 0x01, PP,                          OWDRV_NONE,       0, "(DS1990A), (DS1990R), DS2401, DS2411 1-Wire net address (registration number) only" ) \
+OWFAM( 0x02, PP,                          OWDRV_NONE,     144, "(DS1991) Multikey iButton, 1152-bit secure memory" ) \
+OWFAM( 0x04, PP|OD|OWC_CLOCK,             OWDRV_NONE,     512, "(DS1994), DS2404 4Kb NV RAM memory and clock, timer, alarms" ) \
+OWFAM( 0x05, PP|OWC_SWITCH,               OWDRV_NONE,       0, "DS2405 single addressable switch" ) \
+OWFAM( 0x06, PP|OD,                       OWDRV_NONE,     512, "(DS1993) 4Kb NV RAM memory" ) \
+OWFAM( 0x08, PP|OD,                       OWDRV_NONE,     128, "(DS1992) 1Kb NV RAM memory" ) \
+OWFAM( 0x09, PP,                          OWDRV_NONE,     128, "(DS1982), DS2502 1Kb EPROM memory" ) \
+OWFAM( 0x0A, PP|OD,                       OWDRV_NONE,    2048, "(DS1995) 16Kb NV RAM memory" ) \
+OWFAM( 0x0B, PP,                          OWDRV_NONE,    2048, "(DS1985), DS2505 16Kb EPROM memory" ) \
+OWFAM( 0x0C, PP|OD,                       OWDRV_NONE,    8192, "(DS1996) 64Kb NV RAM memory" ) \
+OWFAM( 0x0F, PP,                          OWDRV_NONE,    8192, "(DS1986), DS2506 64Kb EPROM memory" ) \
+OWFAM( 0x10, PP|OWC_SPU|OWC_TEMP,         OWDRV_TEMP,       0, "(DS1920), DS18S20 temperature with alarm trips" ) \
+OWFAM( 0x12, PP|OD|OWC_SWITCH,            OWDRV_NONE,     128, "DS2406, DS2407 1Kb EPROM memory, 2-channel addressable switch" ) \
+OWFAM( 0x14, PP|OWC_SPU,                  OWDRV_NONE,      32, "(DS1971), DS2430A 256-bit EEPROM memory and 64-bit OTP register" ) \
+OWFAM( 0x16, 0,                           OWDRV_NONE,       0, "(DS1954), (DS1957) coprocessor crypto iButton" ) \
+OWFAM( 0x18, PP|OD,                       OWDRV_NONE,     512, "(DS1963S) 4Kb monetary device with SHA function engine" ) \
+OWFAM( 0x1A, PP|OD,                       OWDRV_NONE,     512, "(DS1963L) 4Kb monetary device" ) \
+OWFAM( 0x1C, PP|OD|OWC_SPU|OWC_SWITCH,    OWDRV_NONE,     512, "DS28E04-100 4096-bit EEPROM memory, 2-channel addressable switch" ) \
+OWFAM( 0x1D, PP|OD,                       OWDRV_NONE,     512, "DS2423 4Kb 1-Wire RAM with counter" ) \
+OWFAM( 0x1F, PP|OD|OWC_COUPLER,           OWDRV_COUPLER,    0, "DS2409 2-channel addressable coupler for sub-netting" ) \
+OWFAM( 0x20, PP|OD|OWC_ADC,               OWDRV_NONE,       0, "DS2450 4-channel A/D converter (ADC)" ) \
+OWFAM( 0x21, PP|OD|OWC_CLOCK,             OWDRV_NONE,     512, "(DS1921G), (DS1921H), (DS1921Z) Thermochron temperature logger" ) \
+OWFAM( 0x22, PP|OWC_SPU|OWC_TEMP,         OWDRV_TEMP,       0, "DS1822 econo digital thermometer" ) \
+OWFAM( 0x23, PP|OD|OWC_SPU,               OWDRV_NONE,     512, "(DS1973), DS2433 4Kb EEPROM memory" ) \
+OWFAM( 0x24, PP|OWC_CLOCK,                OWDRV_NONE,       0, "(DS1904), DS2415 real-time clock (RTC)" ) \
+OWFAM( 0x26, OWC_ADC,                     OWDRV_NONE,      40, "DS2438 temperature, A/D battery monitor" ) \
+OWFAM( 0x27, PP|OWC_CLOCK,                OWDRV_NONE,       0, "DS2417 RTC with interrupt" ) \
+OWFAM( 0x28, PP|OWC_SPU|OWC_TEMP,         OWDRV_TEMP,       0, "DS18B20 programmable resolution digital thermometer" ) \
+OWFAM( 0x29, PP|OD|OWC_SWITCH,            OWDRV_PIO,        0, "DS2408 8-channel addressable switch" ) \
+OWFAM( 0x2C, PP|OD,                       OWDRV_NONE,       0, "DS2890 1-channel digital potentiometer" ) \
+OWFAM( 0x2D, PP|OD|OWC_SPU,               OWDRV_NONE,     128, "(DS1972), DS2431 1024-bit, 1-Wire EEPROM" ) \
+OWFAM( 0x30, OWC_ADC,                     OWDRV_NONE,      32, "DS2760 temperature, current, A/D battery monitor" ) \
+OWFAM( 0x33, PP|OD|OWC_SPU,               OWDRV_NONE,     128, "(DS1961S), DS2432 1K protected EEPROM with SHA-1 engine" ) \
+OWFAM( 0x37, PP|OD|OWC_SPU,               OWDRV_NONE,   32768, "(DS1977) Password-protected 32KB (bytes) EEPROM" ) \
+OWFAM( 0x3A, PP|OD|OWC_SWITCH,            OWDRV_PIO,        0, "DS2413 2-channel addressable switch" ) \
+OWFAM( 0x3B, PP|OWC_SPU|OWC_TEMP,         OWDRV_TEMP,       0, "DS1825 programmable resolution digital thermometer with ID" ) \
+OWFAM( 0x41, PP|OD|OWC_CLOCK,             OWDRV_NONE,    8192, "(DS1922L), (DS1922T), (DS1923), DS2422 high-capacity Thermochron (temperature) and Hygrochron (humidity) loggers" ) \
+OWFAM( 0x42, PP|OD|OWC_SPU|OWC_TEMP|OWC_SWITCH, OWDRV_TEMP, 0, "DS28EA00 programmable resolution digital thermometer with sequence detect and PIO" ) \
+OWFAM( 0x43, PP|OD|OWC_SPU,               OWDRV_NONE,    2560, "DS28EC20 20Kb 1-Wire EEPROM" ) \
+OWFAM( 0x51, OWC_ADC,                     OWDRV_NONE,      32, "DS2751 multichemistry battery fuel gauge" ) \
+OWFAM( 0x81, PP,                          OWDRV_NONE,       0, "USB id - DS1420 serial number in 1-Wire adapters" ) \
+OWFAM( 0x89, PP,                          OWDRV_NONE,     128, "(DS1982U) UniqueWare 1Kb EPROM memory" ) \
+OWFAM( 0x8B, PP,                          OWDRV_NONE,    2048, "(DS1985U) UniqueWare 16Kb EPROM memory" ) \
+OWFAM( 0x8F, PP,                          OWDRV_NONE,    8192, "(DS1986U) UniqueWare 64Kb EPROM memory" )
+
+
+// descriptions - one PROGMEM string per family
+#define OWFAM( code, caps, drv, mem, text ) static const char owfam_desc_##code[] PROGMEM = text;
+OWFAMILY_LIST
+#undef OWFAM
+
+// entry table, in list order
+#define OWFAM( code, caps, drv, mem, text ) { code, (uint8_t)(caps), drv, mem, owfam_desc_##code },
+static const owfamily owfam_table[] PROGMEM = { OWFAMILY_LIST };
+#undef OWFAM
+
+// compile-time search of the codes, used only to build the index
+#define OWFAM( code, caps, drv, mem, text ) code,
+static constexpr uint8_t owfam_codes[] = { OWFAMILY_LIST };
+#undef OWFAM
+
+static constexpr uint8_t owfam_find( uint8_t code, uint8_t ix ) {
+	return ix >= sizeof( owfam_codes ) ? 0xFF
+	     : owfam_codes[ix] == code ? ix
+	     : owfam_find( code, ix + 1 );
+}
+
+static_assert( sizeof( owfam_codes ) < 0xFF, "family table too long for 8 bit index" );
+
+// family code -> entry index, 0xFF for codes not in the list
+#define OWF_I1( c )   owfam_find( (c), 0 )
+#define OWF_I4( c )   OWF_I1( c ), OWF_I1( (c)+1 ), OWF_I1( (c)+2 ), OWF_I1( (c)+3 )
+#define OWF_I16( c )  OWF_I4( c ), OWF_I4( (c)+4 ), OWF_I4( (c)+8 ), OWF_I4( (c)+12 )
+#define OWF_I64( c )  OWF_I16( c ), OWF_I16( (c)+16 ), OWF_I16( (c)+32 ), OWF_I16( (c)+48 )
+static const uint8_t owfam_index[256] PROGMEM = {
+	OWF_I64( 0 ), OWF_I64( 64 ), OWF_I64( 128 ), OWF_I64( 192 )
+};
+
+#undef PP
+#undef OD
+
+
+// Returns: PROGMEM address of the entry for 'code', NULL if unknown
+const owfamily *DS2482family::entry( uint8_t code ) {
+	uint8_t ix = pgm_read_byte( &owfam_index[code] );
+	if( ix == 0xFF ) return NULL;
+	return &owfam_table[ix];
+} //entry( )
+
+bool DS2482family::known( uint8_t code ) {
+	return pgm_read_byte( &owfam_index[code] ) != 0xFF;
+} //known( )
+
+uint8_t DS2482family::caps( uint8_t code ) {
+	const owfamily *e = entry( code );
+	return e ? pgm_read_byte( &e->caps ) : 0;
+} //caps( )
+
+uint8_t DS2482family::driver( uint8_t code ) {
+	const owfamily *e = entry( code );
+	return e ? pgm_read_byte( &e->driver ) : OWDRV_NONE;
+} //driver( )
+
+uint16_t DS2482family::mem( uint8_t code ) {
+	const owfamily *e = entry( code );
+	return e ? pgm_read_word( &e->mem ) : 0;
+} //mem( )
+
+const char *DS2482family::desc( uint8_t code ) {
+	const owfamily *e = entry( code );
+	return e ? (const char *)pgm_read_ptr( &e->desc ) : NULL;
+} //desc( )
@@ -0,0 +1,59 @@
+// DS2482family.h - one-wire family code registry from AN155 Table 1
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised:
+//
+//
+// The family code is the first ROM byte (ROM_NO[0]). The registry gives, for
+// each code in the AN155 "Family Code Reference", a description, capability
+// bits, the memory size and the library driver that handles the device. The
+// table and a 256 byte direct index are built at compile time into PROGMEM,
+// so every lookup is one index read plus one entry read - no search, no copy
+// to RAM. desc( ) returns the PROGMEM address of the description; print it
+// with Serial.print( (const __FlashStringHelper *)DS2482family::desc( code ) ).
+//
+#ifndef DS2482_FAMILY_HDR
+#define DS2482_FAMILY_HDR
+
+#include <Arduino.h>
+
+//capability bits
+#define OWC_OVERDRIVE 0x01  //overdrive speed supported
+#define OWC_PARASITE 0x02   //can run on parasite power
+#define OWC_SPU 0x04        //needs strong pullup for conversion or copy when parasite
+#define OWC_TEMP 0x08       //temperature sensor, answers Read Power Supply
+#define OWC_SWITCH 0x10     //addressable switch (PIO)
+#define OWC_COUPLER 0x20    //branch coupler
+#define OWC_CLOCK 0x40      //real time clock or timer
+#define OWC_ADC 0x80        //A/D or battery monitor
+
+//preferred driver
+#define OWDRV_NONE 0        //ROM access only
+#define OWDRV_TEMP 1        //DS18B20-style thermometer
+#define OWDRV_PIO 2         //DS2482pio channel-access streams
+#define OWDRV_COUPLER 3     //DS2409 branch switching
+
+struct owfamily {
+	uint8_t code;
+	uint8_t caps;
+	uint8_t driver;
+	uint16_t mem;         //memory size in bytes, 0 if none
+	const char *desc;     //PROGMEM string
+};
+
+class DS2482family {
+
+public:
+	static bool known( uint8_t code );
+	static uint8_t caps( uint8_t code );		//0 if unknown
+	static uint8_t driver( uint8_t code );		//OWDRV_NONE if unknown
+	static uint16_t mem( uint8_t code );
+	static const char *desc( uint8_t code );	//PROGMEM string, NULL if unknown
+
+private:
+	static const owfamily *entry( uint8_t code );
+
+}; //class DS2482family
+
+#endif
@@ -0,0 +1,185 @@
+//DS2482log.cpp - sample ring buffer and delta/varint log block coding
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised:
+//
+//
+
+#include "DS2482log.h"
+
+#define ZIGZAG(v) ( ( (uint32_t)(v) << 1 ) ^ (uint32_t)( (int32_t)(v) >> 31 ) )
+#define UNZIGZAG(u) ( (int32_t)( ( (u) >> 1 ) ^ ( 0 - ( (u) & 1 ) ) ) )
+
+DS2482log::DS2482log( owsample *ring, uint16_t _size ) {
+	buf = ring;
+	size = _size;
+	head = 0;
+	n = 0;
+	lost = 0;
+}//constructor
+
+
+//--------------------------------------------------------------------------
+// Store one sample in the ring. When the ring is full the oldest sample is
+// dropped to make room.
+//
+// Returns:  true: stored without loss
+//           false: an older sample was overwritten (counted in lost)
+//
+bool DS2482log::put( uint8_t handle, uint32_t stamp, int16_t raw ) {
+	bool ok = true;
+	if( size == 0 ) return false;
+	if( n == size ) {
+		head = ( head + 1 ) % size;
+		n--;
+		lost++;
+		ok = false;
+	}
+	owsample &s = buf[( head + n ) % size];
+	s.handle = handle;
+	s.stamp = stamp;
+	s.raw = raw;
+	n++;
+	return ok;
+} //put( )
+
+// number of samples waiting to be encoded
+uint16_t DS2482log::count( ) {
+	return n;
+} //count( )
+
+//--------------------------------------------------------------------------
+// Move as many samples as fit from the ring into one log block.
+//
+// 'out'    - block buffer
+// 'outlen' - size of 'out'; LOG_HDRMAX + LOG_RECMAX + 2 always holds at
+//            least one sample
+//
+// Returns:  number of bytes in the block, 0 if the ring is empty or 'out'
+//           is too small for one sample
+//
+int DS2482log::encode( uint8_t *out, int outlen ) {
+	uint8_t rec[LOG_RECMAX];
+	int len;
+	uint8_t cnt = 0;
+
+	if( n == 0 ) return 0;
+
+	// header - count is filled in at the end
+	uint8_t prevh = 0;
+	uint32_t prevs = buf[head].stamp;
+	int16_t prevr = 0;
+	if( outlen < 2 + 5 + 2 ) return 0;
+	out[0] = LOG_MARK;
+	len = 2 + putvar( &out[2], prevs );
+
+	while( n > 0 && cnt < LOG_BLKMAX ) {
+		const owsample &s = buf[head];
+		uint8_t rl = putvar( rec, ZIGZAG( (int32_t)s.handle - prevh ) );
+		rl += putvar( &rec[rl], ZIGZAG( (int32_t)( s.stamp - prevs ) ) );
+		rl += putvar( &rec[rl], ZIGZAG( (int32_t)s.raw - prevr ) );
+		if( len + rl + 2 > outlen ) break;		//keep room for crc
+		for( uint8_t ix=0; ix<rl; ix++ ) out[len++] = rec[ix];
+		prevh = s.handle;
+		prevs = s.stamp;
+		prevr = s.raw;
+		head = ( head + 1 ) % size;
+		n--;
+		cnt++;
+	}
+	if( cnt == 0 ) return 0;
+	out[1] = cnt;
+
+	uint16_t crc = 0;
+	for( int ix=0; ix<len; ix++ ) crc = crc16( crc, out[ix] );
+	crc = ~crc;
+	out[len++] = crc & 0xff;
+	out[len++] = crc >> 8;
+	return len;
+} //encode( )
+
+//--------------------------------------------------------------------------
+// Decode one log block (host side or for readback on the MCU).
+//
+// 'in'     - block bytes, starting at the marker
+// 'inlen'  - bytes available at 'in'
+// 'out'    - receives the samples
+// 'outmax' - room in 'out'
+// 'used'   - if not NULL receives the block length, to step to the next block
+//
+// Returns:  number of samples decoded
+//           -1: not a block, truncated, crc error, or 'out' too small
+//
+int DS2482log::decode( const uint8_t *in, int inlen, owsample *out, int outmax, int *used ) {
+	uint32_t val;
+	uint8_t vl;
+	int pos;
+
+	if( inlen < 2 || in[0] != LOG_MARK ) return -1;
+	uint8_t cnt = in[1];
+	if( cnt > outmax ) return -1;
+	pos = 2;
+	if( !( vl = getvar( &in[pos], inlen - pos, &val ) ) ) return -1;
+	pos += vl;
+
+	uint8_t prevh = 0;
+	uint32_t prevs = val;
+	int16_t prevr = 0;
+	for( uint8_t ix=0; ix<cnt; ix++ ) {
+		if( !( vl = getvar( &in[pos], inlen - pos, &val ) ) ) return -1;
+		pos += vl;
+		prevh = (uint8_t)( prevh + UNZIGZAG( val ) );
+		if( !( vl = getvar( &in[pos], inlen - pos, &val ) ) ) return -1;
+		pos += vl;
+		prevs += (uint32_t)UNZIGZAG( val );
+		if( !( vl = getvar( &in[pos], inlen - pos, &val ) ) ) return -1;
+		pos += vl;
+		prevr = (int16_t)( prevr + UNZIGZAG( val ) );
+		out[ix].handle = prevh;
+		out[ix].stamp = prevs;
+		out[ix].raw = prevr;
+	}
+	if( pos + 2 > inlen ) return -1;
+
+	uint16_t crc = 0;
+	for( int ix=0; ix<pos+2; ix++ ) crc = crc16( crc, in[ix] );
+	if( crc != 0xB001 ) return -1;			//residue with inverted crc appended
+	if( used ) *used = pos + 2;
+	return cnt;
+} //decode( )
+
+
+// unsigned LEB128 - 7 bits per byte, high bit set on all but the last
+uint8_t DS2482log::putvar( uint8_t *out, uint32_t val ) {
+	uint8_t len = 0;
+	while( val >= 0x80 ) {
+		out[len++] = (uint8_t)val | 0x80;
+		val >>= 7;
+	}
+	out[len++] = (uint8_t)val;
+	return len;
+} //putvar( )
+
+// returns bytes used, 0 if truncated or longer than a uint32_t
+uint8_t DS2482log::getvar( const uint8_t *in, int inlen, uint32_t *val ) {
+	uint32_t v = 0;
+	for( uint8_t ix=0; ix<5 && ix<inlen; ix++ ) {
+		v |= (uint32_t)( in[ix] & 0x7f ) << ( 7 * ix );
+		if( !( in[ix] & 0x80 ) ) {
+			*val = v;
+			return ix + 1;
+		}
+	}
+	return 0;
+} //getvar( )
+
+// 1-wire CRC16, bitwise so the host side needs no DS2482 object
+uint16_t DS2482log::crc16( uint16_t crc, uint8_t data ) {
+	crc ^= data;
+	for( uint8_t ix=0; ix<8; ix++ ) {
+		if( crc & 1 ) crc = ( crc >> 1 ) ^ 0xA001;
+		else crc >>= 1;
+	}
+	return crc;
+} //crc16( )
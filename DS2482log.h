@@ -0,0 +1,68 @@
+// DS2482log.h - timestamped sample ring buffer and compact binary log blocks
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised:
+//
+//
+// Samples are (device handle, timestamp, raw value) records - the handle is
+// whatever index the sketch uses for its device table, the timestamp is in the
+// sketch's units (millis, seconds from an RTC, ...), and the raw value is the
+// device reading as read, e.g. the DS18B20 16X temperature. put( ) stores a
+// record in a fixed ring of caller-supplied storage; when the ring is full the
+// oldest record is overwritten and counted in 'lost'.
+//
+// encode( ) moves records out of the ring into a self-contained block:
+//
+//   0xD5  count  varint(first stamp)  records...  crc16 (lsb first)
+//
+// each record being varint(zigzag(handle delta)), varint(zigzag(stamp delta))
+// and varint(zigzag(raw delta)) against the previous record in the block.
+// A sweep of sensors read in handle order with similar readings encodes in
+// about 3 bytes per sample. Blocks can be written as they are to SD, EEPROM or
+// a file; decode( ) reverses one block.
+//
+// Nothing here needs the bridge or Arduino.h, so the same two files build on
+// the host side for decoding.
+//
+#ifndef DS2482_LOG_HDR
+#define DS2482_LOG_HDR
+
+#include <stdint.h>
+
+#define LOG_MARK 0xD5       //first byte of every block
+#define LOG_HDRMAX 7        //marker, count, stamp varint
+#define LOG_RECMAX 10       //largest encoded record
+#define LOG_BLKMAX 255      //records per block
+
+struct owsample {
+	uint8_t handle;       //device index
+	uint32_t stamp;       //time of reading
+	int16_t raw;          //reading as returned by device
+};
+
+class DS2482log {
+
+public:
+	DS2482log( owsample *ring, uint16_t size );	//ring storage from caller
+
+	bool put( uint8_t handle, uint32_t stamp, int16_t raw );
+	uint16_t count( );
+	int encode( uint8_t *out, int outlen );
+	static int decode( const uint8_t *in, int inlen, owsample *out, int outmax, int *used );
+
+	uint16_t lost;        //records overwritten before encode
+
+private:
+	owsample *buf;
+	uint16_t size;
+	uint16_t head;        //oldest record
+	uint16_t n;
+
+	static uint8_t putvar( uint8_t *out, uint32_t val );
+	static uint8_t getvar( const uint8_t *in, int inlen, uint32_t *val );
+	static uint16_t crc16( uint16_t crc, uint8_t data );
+
+}; //class DS2482log
+
+#endif
@@ -0,0 +1,151 @@
+//DS2482pio.cpp - DS2408/DS2413 channel-access streams over the DS2482 bridge
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - refuse devices the registry does not list as PIO
+//
+//
+
+#include "DS2482pio.h"
+#include "DS2482family.h"
+
+DS2482pio::DS2482pio( DS2482 &bridge ) : ow( bridge ) {
+	family = DS2408_FAMILY;
+	mode = 0;
+	blkcnt = 0;
+	crc16 = 0;
+	crc_error = false;
+}//constructor
+
+
+// reset, address the switch and issue the channel-access command
+bool DS2482pio::start( const uint8_t *rom, uint8_t cmd ) {
+	mode = 0;
+	if( rom && DS2482family::driver( rom[0] ) != OWDRV_PIO ) return false;
+	if( !ow.OWReset( ) ) return false;
+	if( rom ) {
+		family = rom[0];
+		ow.OWWriteByte( 0x55 );			//match ROM
+		for( uint8_t ix=0; ix<8; ix++ ) ow.OWWriteByte( rom[ix] );
+	} else {
+		ow.OWWriteByte( 0xCC );			//skip ROM
+	}
+	ow.OWWriteByte( cmd );
+	mode = cmd;
+	blkcnt = 0;
+	crc16 = DS2482::calc_crc16( 0, cmd );	//first DS2408 block includes command
+	crc_error = false;
+	return true;
+} //start( )
+
+
+//--------------------------------------------------------------------------
+// Open a Channel-Access Read stream on a switch.
+//
+// 'rom' - 8 byte ROM of a DS2408 or DS2413; NULL uses skip ROM and assumes
+//         the family of the last switch opened (DS2408 by default)
+//
+// Returns:  true: presence detected and read stream started
+//           false: no presence pulse, or 'rom' is not a DS2408/DS2413
+//
+bool DS2482pio::readBegin( const uint8_t *rom ) {
+	return start( rom, PIO_CAREAD );
+} //readBegin( )
+
+//--------------------------------------------------------------------------
+// Read consecutive PIO samples from an open read stream. For a DS2408 the
+// CRC16 checkpoint bytes are read and checked in passing and never appear
+// in 'buf'. For a DS2413 each sample is the status byte with its complement
+// nibble checked; the stored sample keeps only the low nibble.
+//
+// 'buf'   - receives the samples
+// 'count' - number of samples wanted
+//
+// Returns:  number of samples stored; fewer than 'count' when a checkpoint
+//           failed (crc_error set - samples since the previous good
+//           checkpoint are suspect) or no read stream is open
+//
+int DS2482pio::readSamples( uint8_t *buf, int count ) {
+	int ix;
+
+	if( mode != PIO_CAREAD ) return 0;
+	for( ix=0; ix<count; ix++ ) {
+		uint8_t sample = ow.OWReadByte( );
+		if( family == DS2413_FAMILY ) {
+			if( ( sample >> 4 ) != ( ~sample & 0x0f ) ) {
+				crc_error = true;
+				break;
+			}
+			buf[ix] = sample & 0x0f;
+			continue;
+		}
+		buf[ix] = sample;
+		crc16 = DS2482::calc_crc16( crc16, sample );
+		if( ++blkcnt == PIO_CRCBLK ) {
+			crc16 = DS2482::calc_crc16( crc16, ow.OWReadByte( ) );
+			crc16 = DS2482::calc_crc16( crc16, ow.OWReadByte( ) );
+			if( crc16 != PIO_CRCOK ) {
+				crc_error = true;
+				ix++;
+				break;
+			}
+			crc16 = 0;
+			blkcnt = 0;
+		}
+	}
+	return ix;
+} //readSamples( )
+
+
+//--------------------------------------------------------------------------
+// Open a Channel-Access Write stream on a switch. Arguments and return as
+// readBegin( ).
+//
+bool DS2482pio::writeBegin( const uint8_t *rom ) {
+	return start( rom, PIO_CAWRITE );
+} //writeBegin( )
+
+//--------------------------------------------------------------------------
+// Write one output value on an open write stream and check the switch's
+// confirmation byte.
+//
+// 'pio'   - output latch value; for a DS2413 bit 0 is PIOA, bit 1 is PIOB
+// 'state' - if not NULL receives the pin state the switch reports back
+//
+// Returns:  true: switch confirmed the write
+//           false: no confirmation - the stream should be ended
+//
+bool DS2482pio::writeSample( uint8_t pio, uint8_t *state ) {
+	if( mode != PIO_CAWRITE ) return false;
+	if( family == DS2413_FAMILY ) pio |= 0xFC;	//unused bits must be sent as 1
+	ow.OWWriteByte( pio );
+	ow.OWWriteByte( ~pio );
+	if( ow.OWReadByte( ) != PIO_CONFIRM ) return false;
+	uint8_t pins = ow.OWReadByte( );
+	if( state ) *state = ( family == DS2413_FAMILY ) ? ( pins & 0x0f ) : pins;
+	return true;
+} //writeSample( )
+
+//--------------------------------------------------------------------------
+// Write a run of output values on an open write stream.
+//
+// 'pio'   - values to write
+// 'state' - if not NULL receives the reported pin state for each write
+// 'count' - number of values
+//
+// Returns:  number of writes confirmed; stops at the first unconfirmed one
+//
+int DS2482pio::writeSamples( const uint8_t *pio, uint8_t *state, int count ) {
+	int ix;
+
+	for( ix=0; ix<count; ix++ ) {
+		if( !writeSample( pio[ix], state ? &state[ix] : NULL ) ) break;
+	}
+	return ix;
+} //writeSamples( )
+
+// close a read or write stream - any 1-wire reset ends channel access
+void DS2482pio::end( ) {
+	if( mode ) ow.OWReset( );
+	mode = 0;
+} //end( )
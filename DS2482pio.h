@@ -0,0 +1,60 @@
+// DS2482pio.h - channel-access streaming for DS2408 and DS2413 addressable switches
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised:
+//
+//
+// A Channel-Access Read leaves the switch sending PIO samples for as long as
+// the master keeps reading, so a stream costs one reset, one Match ROM and one
+// command byte, then one 1-wire byte per sample. The DS2408 inserts an inverted
+// CRC16 after every 32 samples (the first block also covers the command
+// byte); the DS2413 sends its status nibble with its complement instead. The
+// Channel-Access Write stream is the same idea for outputs: data byte, its
+// complement, then the switch answers with 0xAA and the new pin state.
+//
+// A stream ends with end( ), which resets the 1-wire bus.
+//
+#ifndef DS2482_PIO_HDR
+#define DS2482_PIO_HDR
+
+#include "DS2482.h"
+
+//switch family codes
+#define DS2408_FAMILY 0x29
+#define DS2413_FAMILY 0x3A
+
+//channel-access function commands
+#define PIO_CAREAD  0xF5   //channel-access read
+#define PIO_CAWRITE 0x5A   //channel-access write
+#define PIO_CONFIRM 0xAA   //write confirmation byte from switch
+
+#define PIO_CRCBLK 32      //DS2408 samples between CRC16 checkpoints
+#define PIO_CRCOK 0xB001   //crc16 residue over data plus inverted crc
+
+class DS2482pio {
+
+public:
+	DS2482pio( DS2482 &bridge );
+
+	bool readBegin( const uint8_t *rom );	//rom NULL - skip ROM (single switch)
+	int readSamples( uint8_t *buf, int count );
+	bool writeBegin( const uint8_t *rom );
+	bool writeSample( uint8_t pio, uint8_t *state );
+	int writeSamples( const uint8_t *pio, uint8_t *state, int count );
+	void end( );
+
+	bool crc_error;		//last readSamples stopped on bad crc or complement
+
+private:
+	DS2482 &ow;
+	uint8_t family;
+	uint8_t mode;		//PIO_CAREAD, PIO_CAWRITE or 0 when idle
+	uint8_t blkcnt;		//samples since last DS2408 crc checkpoint
+	uint16_t crc16;
+
+	bool start( const uint8_t *rom, uint8_t cmd );
+
+}; //class DS2482pio
+
+#endif
@@ -0,0 +1,138 @@
+//DS2482queue.cpp - thread-safe command queue for a shared DS2482 bridge
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - catch exceptions from post( ) jobs
+//
+//
+
+#include "DS2482queue.h"
+
+#if defined(__linux__)
+
+DS2482queue::DS2482queue( DS2482 &bridge ) : ow( bridge ) {
+	stub.next.store( nullptr, std::memory_order_relaxed );
+	head.store( &stub, std::memory_order_relaxed );
+	tail = &stub;
+	pending.store( 0 );
+	done.store( 0 );
+	thrown.store( 0 );
+	running.store( false );
+}//constructor
+
+DS2482queue::~DS2482queue( ) {
+	end( );
+	// jobs posted after end( ) never ran - release them
+	node *n;
+	while( ( n = pop( ) ) != nullptr ) delete n;
+}//destructor
+
+void DS2482queue::begin( ) {
+	if( running.exchange( true ) ) return;		//already started
+	worker = std::thread( &DS2482queue::run, this );
+} //begin
+
+//--------------------------------------------------------------------------
+// Stop the worker. Jobs already queued are run before the worker exits so
+// every future handed out by submit( ) is satisfied.
+//
+void DS2482queue::end( ) {
+	if( !running.exchange( false ) ) return;
+	{
+		std::lock_guard<std::mutex> lk( idle );
+		wake.notify_one( );
+	}
+	worker.join( );
+} //end
+
+unsigned long DS2482queue::completed( ) const {
+	return done.load( );
+} //completed( )
+
+unsigned long DS2482queue::failed( ) const {
+	return thrown.load( );
+} //failed( )
+
+//--------------------------------------------------------------------------
+// Queue a transaction. Callable from any thread; never blocks on other
+// producers. If the job throws, the worker catches it and counts it in
+// failed( ); report errors through the job's own callback instead. The
+// worker is signalled only on the empty to non-empty transition, which is
+// the only time it can be asleep.
+//
+void DS2482queue::post( owjob job ) {
+	node *n = new node;
+	n->job = std::move( job );
+	push( n );
+	if( pending.fetch_add( 1 ) == 0 ) {
+		std::lock_guard<std::mutex> lk( idle );
+		wake.notify_one( );
+	}
+} //post( )
+
+
+// producer side - one atomic exchange links the node in
+void DS2482queue::push( node *n ) {
+	n->next.store( nullptr, std::memory_order_relaxed );
+	node *prev = head.exchange( n, std::memory_order_acq_rel );
+	prev->next.store( n, std::memory_order_release );
+} //push( )
+
+//--------------------------------------------------------------------------
+// Consumer side of the list, worker thread only.
+//
+// Returns: oldest queued node, or nullptr if the list is empty or a
+//          producer is between its exchange and its link store
+//
+DS2482queue::node *DS2482queue::pop( ) {
+	node *t = tail;
+	node *next = t->next.load( std::memory_order_acquire );
+	if( t == &stub ) {
+		if( next == nullptr ) return nullptr;
+		tail = next;
+		t = next;
+		next = next->next.load( std::memory_order_acquire );
+	}
+	if( next != nullptr ) {
+		tail = next;
+		return t;
+	}
+	if( t != head.load( std::memory_order_acquire ) ) return nullptr;
+	push( &stub );				//t is last - put stub behind it to release it
+	next = t->next.load( std::memory_order_acquire );
+	if( next != nullptr ) {
+		tail = next;
+		return t;
+	}
+	return nullptr;
+} //pop( )
+
+//--------------------------------------------------------------------------
+// Worker loop - the only code that touches the bridge once begin( ) is
+// called. Drains the list back-to-back, sleeps only when nothing is pending.
+//
+void DS2482queue::run( ) {
+	for( ;; ) {
+		node *n = pop( );
+		if( n != nullptr ) {
+			try {
+				n->job( ow );
+			} catch( ... ) {		//post( ) job threw - keep serving the rest
+				thrown.fetch_add( 1 );
+			}
+			delete n;
+			done.fetch_add( 1 );
+			pending.fetch_sub( 1 );
+			continue;
+		}
+		if( pending.load( ) > 0 ) {		//producer mid-push, node arrives shortly
+			std::this_thread::yield( );
+			continue;
+		}
+		std::unique_lock<std::mutex> lk( idle );
+		wake.wait( lk, [this] { return pending.load( ) > 0 || !running.load( ); } );
+		if( pending.load( ) == 0 && !running.load( ) ) break;
+	}
+} //run( )
+
+#endif // __linux__
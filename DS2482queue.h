@@ -0,0 +1,112 @@
+// DS2482queue.h - command queue front-end for sharing one bridge among threads
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised: Oct 19/26 - exceptions from post( ) jobs caught and counted
+//
+//
+// On a multi-threaded host (linux gateway) the DS2482 object cannot be shared
+// directly: the search state, crc8 and ROM_NO all change under each call. The
+// queue makes a single worker thread the owner of the bridge. Any thread may
+// submit a 1-wire transaction - a function taking the DS2482 object - and the
+// worker runs the transactions back-to-back. Submission is lock-free (an
+// intrusive multi-producer, single-consumer list) so producers never wait on
+// each other; the idle mutex is touched only when the worker has gone to sleep.
+//
+// Results come back either through a std::future (submit) or through whatever
+// callback the transaction itself calls (post). An exception thrown by a
+// submit( ) job is delivered through its future; one thrown by a post( ) job
+// is caught by the worker, counted in failed( ) and otherwise dropped, so a
+// bad job cannot take the worker - and the process - down.
+//
+// examples/queueBench times the queue with 1 to 8 submitting threads.
+//
+// Only built where std::thread is available (linux); on the arduino targets
+// this header declares nothing.
+//
+#ifndef DS2482_QUEUE_HDR
+#define DS2482_QUEUE_HDR
+
+#if defined(__linux__)
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "DS2482.h"
+
+class DS2482queue {
+
+public:
+	typedef std::function<void( DS2482 & )> owjob;
+
+	DS2482queue( DS2482 &bridge );		//bridge must be detected and configured
+	~DS2482queue( );
+
+	void begin( );			//start the bus-owner worker thread
+	void end( );			//finish queued jobs, stop the worker
+
+	void post( owjob job );		//queue a job; job reports its own result
+	template<typename F>
+	auto submit( F f ) -> std::future<decltype( f( std::declval<DS2482 &>( ) ) )>;
+
+	unsigned long completed( ) const;	//number of jobs run so far
+	unsigned long failed( ) const;		//post( ) jobs that threw
+
+private:
+	struct node {
+		std::atomic<node *> next;
+		owjob job;
+	};
+
+	void push( node *n );
+	node *pop( );
+	void run( );
+
+	DS2482 &ow;
+
+// MPSC list - producers exchange head, only the worker touches tail
+	std::atomic<node *> head;
+	node *tail;
+	node stub;
+
+	std::atomic<long> pending;
+	std::atomic<unsigned long> done;
+	std::atomic<unsigned long> thrown;
+	std::atomic<bool> running;
+	std::mutex idle;
+	std::condition_variable wake;
+	std::thread worker;
+
+	DS2482queue( const DS2482queue & );
+	DS2482queue &operator=( const DS2482queue & );
+
+}; //class DS2482queue
+
+
+//--------------------------------------------------------------------------
+// Queue a transaction whose return value is wanted by the caller.
+//
+// 'f' - callable taking DS2482& ; it runs on the worker thread
+//
+// Returns: future which becomes ready when the worker has run 'f'
+//
+template<typename F>
+auto DS2482queue::submit( F f ) -> std::future<decltype( f( std::declval<DS2482 &>( ) ) )>
+{
+	typedef decltype( f( std::declval<DS2482 &>( ) ) ) R;
+	std::shared_ptr<std::packaged_task<R( DS2482 & )> > task =
+		std::make_shared<std::packaged_task<R( DS2482 & )> >( f );
+	std::future<R> result = task->get_future( );
+	post( [task]( DS2482 &bridge ) { ( *task )( bridge ); } );
+	return result;
+} //submit( )
+
+#endif // __linux__
+
+#endif
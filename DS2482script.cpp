@@ -0,0 +1,209 @@
+//DS2482script.cpp - interpreter for precompiled 1-wire transaction scripts
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - notes on the pullup release
+//
+//
+
+#include "DS2482script.h"
+
+DS2482script::DS2482script( DS2482 &bridge ) : ow( bridge ) {
+	pc = NULL;
+	rom = NULL;
+	buf = NULL;
+	nread = 0;
+	wait_start = 0;
+	wait_ms = 0;
+	spu = false;
+}//constructor
+
+
+//--------------------------------------------------------------------------
+// Check a script before use: known opcodes, an OWS_END, reads that fit the
+// buffer and CRC checks that cover only bytes already read.
+//
+// 'script' - PROGMEM script
+// 'buflen' - size of the buffer the script will be run with
+//
+// Returns:  number of bytes the script reads (>= 0) if valid
+//           OWS_EOP, OWS_ELEN on error
+//
+int DS2482script::validate( const uint8_t *script, uint8_t buflen ) {
+	uint16_t ix = 0;
+	uint16_t reads = 0;
+
+	while( ix < OWS_MAXLEN ) {
+		uint8_t op = pgm_read_byte( &script[ix++] );
+		uint8_t n;
+		switch( op ) {
+		case OWS_END:
+			return reads;
+		case OWS_RESET:
+		case OWS_SKIP:
+		case OWS_MATCH:
+		case OWS_LEVEL:
+			break;
+		case OWS_OPWRITE:
+			ix += 1 + pgm_read_byte( &script[ix] );
+			break;
+		case OWS_OPREAD:
+			reads += pgm_read_byte( &script[ix++] );
+			if( reads > buflen ) return OWS_ELEN;
+			break;
+		case OWS_OPCRC8:
+		case OWS_OPCRC16:
+			n = pgm_read_byte( &script[ix++] );
+			if( n > reads || ( op == OWS_OPCRC16 && n < 2 ) ) return OWS_ELEN;
+			break;
+		case OWS_OPPOWER:
+			ix += 1;
+			break;
+		case OWS_OPWAIT:
+			ix += 2;
+			break;
+		default:
+			return OWS_EOP;
+		}
+	}
+	return OWS_EOP;			//no OWS_END
+} //validate( )
+
+//--------------------------------------------------------------------------
+// Begin a script; it runs on calls to step( ).
+//
+// 'script' - PROGMEM script, checked with validate( )
+// 'rom'    - device for OWS_MATCH, may be NULL if the script has none
+// 'buf'    - receives the bytes read
+//
+void DS2482script::start( const uint8_t *script, const uint8_t *_rom, uint8_t *_buf ) {
+	pc = script;
+	rom = _rom;
+	buf = _buf;
+	nread = 0;
+	wait_ms = 0;
+	spu = false;
+} //start( )
+
+//--------------------------------------------------------------------------
+// Run the script from where it stopped up to the next unexpired OWS_WAIT or
+// the end. Each 1-wire step blocks only for its own bus time.
+//
+// Returns:  OWS_BUSY: waiting, call again
+//           OWS_DONE: script completed, results in buf
+//           OWS_ENOPRES, OWS_ECRC, OWS_EOP: script abandoned
+//           OWS_EIDLE: no script started
+//
+int DS2482script::step( ) {
+	uint8_t n;
+	int rslt = OWS_DONE;
+
+	if( pc == NULL ) return OWS_EIDLE;
+	if( wait_ms ) {
+		if( millis( ) - wait_start < wait_ms ) return OWS_BUSY;
+		wait_ms = 0;
+	}
+
+	for( ;; ) {
+		uint8_t op = fetch( );
+
+		// any 1-wire command ends the strong pullup and clears SPU; APU was
+		// kept set by OWWriteBytePower, so no config write is needed
+		if( spu && releases( op ) ) {
+			spu = false;
+			ow.cSPU = 0;
+		}
+
+		switch( op ) {
+		case OWS_END:
+			break;
+		case OWS_RESET:
+			if( !ow.OWReset( ) ) rslt = OWS_ENOPRES;
+			break;
+		case OWS_SKIP:
+			ow.OWWriteByte( 0xCC );
+			break;
+		case OWS_MATCH:
+			ow.OWWriteByte( 0x55 );
+			for( n=0; n<8; n++ ) ow.OWWriteByte( rom[n] );
+			break;
+		case OWS_OPWRITE:
+			for( n = fetch( ); n > 0; n-- ) ow.OWWriteByte( fetch( ) );
+			break;
+		case OWS_OPREAD:
+			for( n = fetch( ); n > 0; n-- ) buf[nread++] = ow.OWReadByte( );
+			break;
+		case OWS_OPCRC8:
+			n = fetch( );
+			ow.crc8 = 0;
+			for( uint8_t ix = nread - n; ix < nread; ix++ ) ow.calc_crc8( buf[ix] );
+			if( ow.crc8 != 0 ) rslt = OWS_ECRC;
+			break;
+		case OWS_OPCRC16: {
+			uint16_t crc16 = 0;
+			n = fetch( );
+			for( uint8_t ix = nread - n; ix < nread; ix++ ) crc16 = DS2482::calc_crc16( crc16, buf[ix] );
+			if( crc16 != 0xB001 ) rslt = OWS_ECRC;
+			break;
+		}
+		case OWS_OPPOWER:
+			if( !ow.OWWriteBytePower( fetch( ) ) ) rslt = OWS_ENOPRES;
+			else spu = true;
+			break;
+		case OWS_OPWAIT:
+			wait_ms = fetch( );
+			wait_ms |= (uint16_t)fetch( ) << 8;
+			wait_start = millis( );
+			if( wait_ms ) return OWS_BUSY;
+			break;
+		case OWS_LEVEL:
+			// skipped when the next step is a 1-wire command - it ends the pullup
+			if( spu && !releases( pgm_read_byte( pc ) ) ) {
+				ow.OWLevel( MODE_STANDARD );
+				spu = false;
+			}
+			break;
+		default:
+			rslt = OWS_EOP;
+			break;
+		}
+
+		if( op == OWS_END || rslt != OWS_DONE ) break;
+	}
+
+	if( spu ) ow.OWLevel( MODE_STANDARD );		//never leave strong pullup on
+	spu = false;
+	pc = NULL;
+	return rslt;
+} //step( )
+
+//--------------------------------------------------------------------------
+// Run a script to completion, sleeping through its waits.
+//
+// Returns:  as step( ), never OWS_BUSY
+//
+int DS2482script::run( const uint8_t *script, const uint8_t *_rom, uint8_t *_buf ) {
+	int rslt;
+
+	start( script, _rom, _buf );
+	while( ( rslt = step( ) ) == OWS_BUSY ) {
+		unsigned long elapsed = millis( ) - wait_start;
+		if( elapsed < wait_ms ) delay( wait_ms - elapsed );
+	}
+	return rslt;
+} //run( )
+
+// true for steps that issue a 1-wire command, which ends any strong pullup
+bool DS2482script::releases( uint8_t op ) {
+	switch( op ) {
+	case OWS_RESET:
+	case OWS_SKIP:
+	case OWS_MATCH:
+	case OWS_OPWRITE:
+	case OWS_OPREAD:
+	case OWS_OPPOWER:
+		return true;
+	default:
+		return false;
+	}
+} //releases( )
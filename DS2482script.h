@@ -0,0 +1,90 @@
+// DS2482script.h - precompiled 1-wire transaction scripts and their interpreter
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised: Oct 19/26 - say what is and is not saved
+//
+//
+// A device protocol (reset, address, command, read, check CRC, powered write,
+// wait) is written once as a PROGMEM byte array with the OWS_ macros, e.g.
+//
+//   const uint8_t readTemp[] PROGMEM = {
+//     OWS_RESET, OWS_MATCH, OWS_WRITE( 1 ), CRSPD, OWS_READ( 9 ), OWS_CRC8( 9 ),
+//     OWS_END };
+//
+// validate( ) checks a script once; the interpreter then runs it against any
+// device ROM with results going to a caller buffer. run( ) blocks until the
+// script ends. start( ) and step( ) run the same script without blocking
+// through its OWS_WAIT steps, so a conversion can proceed while the sketch
+// does other work.
+//
+// The DS2482 has no block write or read command, so OWS_WRITE and OWS_READ
+// still send one byte command per 1-wire byte - nothing is merged there. The
+// saving is in the strong pullup: OWS_LEVEL sends no config write when the
+// next step is a 1-wire command, because the bridge clears SPU itself at the
+// next command and OWWriteBytePower keeps APU set in the config it writes.
+//
+#ifndef DS2482_SCRIPT_HDR
+#define DS2482_SCRIPT_HDR
+
+#include "DS2482.h"
+
+//script opcodes
+#define OWS_END     0x00    //end of script
+#define OWS_RESET   0x01    //1-wire reset, fail if no presence
+#define OWS_SKIP    0x02    //skip ROM
+#define OWS_MATCH   0x03    //match ROM of device given to start( )/run( )
+#define OWS_OPWRITE 0x04    //n, n bytes: write bytes
+#define OWS_OPREAD  0x05    //n: read n bytes to buffer
+#define OWS_OPCRC8  0x06    //n: last n bytes read must have crc8 0
+#define OWS_OPCRC16 0x07    //n: last n bytes read end with inverted crc16
+#define OWS_OPPOWER 0x08    //b: write b then hold strong pullup
+#define OWS_OPWAIT  0x09    //lo, hi: wait ms
+#define OWS_LEVEL   0x0A    //release strong pullup
+
+//script building macros
+#define OWS_WRITE( n )  OWS_OPWRITE, (n)
+#define OWS_READ( n )   OWS_OPREAD, (n)
+#define OWS_CRC8( n )   OWS_OPCRC8, (n)
+#define OWS_CRC16( n )  OWS_OPCRC16, (n)
+#define OWS_POWER( b )  OWS_OPPOWER, (b)
+#define OWS_WAIT( ms )  OWS_OPWAIT, ( (ms) & 0xFF ), ( ( (ms) >> 8 ) & 0xFF )
+
+//step( ) and run( ) results; validate( ) errors
+#define OWS_DONE 0          //script completed
+#define OWS_BUSY 1          //waiting, call step( ) again
+#define OWS_ENOPRES -1      //no presence pulse at OWS_RESET
+#define OWS_ECRC -2         //crc check failed
+#define OWS_EOP -3          //bad opcode or truncated script
+#define OWS_ELEN -4         //reads exceed buffer, crc span exceeds reads
+#define OWS_EIDLE -5        //step( ) with no script started
+
+#define OWS_MAXLEN 255      //longest script accepted by validate( )
+
+class DS2482script {
+
+public:
+	DS2482script( DS2482 &bridge );
+
+	static int validate( const uint8_t *script, uint8_t buflen );
+	void start( const uint8_t *script, const uint8_t *rom, uint8_t *buf );
+	int step( );
+	int run( const uint8_t *script, const uint8_t *rom, uint8_t *buf );
+
+	uint8_t nread;		//bytes read into buf so far
+
+private:
+	DS2482 &ow;
+	const uint8_t *pc;	//next opcode, PROGMEM
+	const uint8_t *rom;
+	uint8_t *buf;
+	unsigned long wait_start;
+	uint16_t wait_ms;	//non-zero while an OWS_WAIT is pending
+	bool spu;		//strong pullup on
+
+	uint8_t fetch( ) { return pgm_read_byte( pc++ ); }
+	static bool releases( uint8_t op );
+
+}; //class DS2482script
+
+#endif
@@ -0,0 +1,235 @@
+//DS2482table.cpp - device table, persistence and warm start
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - properties from family registry
+//          Oct 19/26 - skip devices of upstream tables
+//          Oct 19/26 - no separate reset before warm start verify
+//          Oct 19/26 - complete( ) - table known to hold the whole bus
+//
+//
+
+#include "DS2482table.h"
+#include "DS2482family.h"
+
+DS2482table::DS2482table( owdevice *devs, uint8_t _maxdev ) {
+	dev = devs;
+	maxdev = _maxdev;
+	count = 0;
+	upstream = NULL;
+	searching = false;
+	whole = false;
+	dropped = false;
+}//constructor
+
+
+//--------------------------------------------------------------------------
+// Full enumeration of the bus into the table. Devices already in the table
+// keep their handles.
+//
+// Returns:  number of devices in the table
+//
+uint8_t DS2482table::discover( DS2482 &bridge ) {
+	searching = false;
+	while( discoverStep( bridge ) ) { /* next device */ }
+	return count;
+} //discover( )
+
+//--------------------------------------------------------------------------
+// One step of a rediscovery pass - a single OWFirst or OWNext - so the pass
+// can be spread between samples. The pass keeps its place in the bridge's
+// search state, so between steps use only calls that leave it alone:
+// OWReset, byte/bit/block i/o, OWWriteBytePower/OWLevel, DS2482script runs
+// and OWVerify (which restores it). OWFirst, OWNext, OWSearch, search( )
+// ranges, OWTargetSetup/OWFamilySkipSetup, another table's discover or
+// DS2482coupler::discover on the same bridge clear or overwrite it - the
+// pass then restarts or loses its place - so finish the pass first.
+//
+// Returns:  true: pass in progress, call again
+//           false: pass complete; devices not found are marked OWD_GONE
+//
+bool DS2482table::discoverStep( DS2482 &bridge ) {
+	bool found;
+
+	if( !searching ) {
+		for( uint8_t ix=0; ix<count; ix++ ) dev[ix].flags &= ~OWD_SEEN;
+		searching = true;
+		dropped = false;
+		found = bridge.OWFirst( );
+	} else {
+		found = bridge.OWNext( );
+	}
+
+	if( found ) {
+		int idx = find( bridge.ROM_NO );
+		if( idx < 0 && inUpstream( bridge.ROM_NO ) ) return true;	//belongs above
+		if( idx < 0 ) {
+			idx = add( bridge.ROM_NO, 0 );
+			if( idx >= 0 ) probe( bridge, dev[idx] );
+			else dropped = true;			//table full
+		}
+		if( idx >= 0 ) dev[idx].flags = ( dev[idx].flags & ~OWD_GONE ) | OWD_SEEN;
+		return true;
+	}
+
+	for( uint8_t ix=0; ix<count; ix++ ) {
+		if( dev[ix].flags & OWD_SEEN ) dev[ix].flags &= ~OWD_SEEN;
+		else dev[ix].flags |= OWD_GONE;
+	}
+	searching = false;
+	whole = !dropped;
+	return false;
+} //discoverStep( )
+
+// Returns: handle of device with ROM 'rom', -1 if not in table
+int DS2482table::find( const uint8_t *rom ) const {
+	for( uint8_t ix=0; ix<count; ix++ ) {
+		uint8_t kx;
+		for( kx=0; kx<8; kx++ ) {
+			if( dev[ix].rom[kx] != rom[kx] ) break;
+		}
+		if( kx == 8 ) return ix;
+	}
+	return -1;
+} //find( )
+
+//--------------------------------------------------------------------------
+// Whether the table is known to list every device on the bus, so a skip ROM
+// command reaches only devices in it.
+//
+// Returns:  true: the last full pass completed with no device dropped for
+//                 lack of room, no pass is in progress and the table is not
+//                 a coupler branch (no upstream)
+//           false: otherwise, including a table only loaded from an image
+//
+bool DS2482table::complete( ) const {
+	return whole && !searching && upstream == NULL;
+} //complete( )
+
+// Returns: true if 'rom' is in an upstream table
+bool DS2482table::inUpstream( const uint8_t *rom ) const {
+	for( const DS2482table *up = upstream; up != NULL; up = up->upstream ) {
+		if( up->find( rom ) >= 0 ) return true;
+	}
+	return false;
+} //inUpstream( )
+
+// Returns: handle of added device, -1 if table full
+int DS2482table::add( const uint8_t *rom, uint8_t flags ) {
+	if( count >= maxdev ) return -1;
+	for( uint8_t kx=0; kx<8; kx++ ) dev[count].rom[kx] = rom[kx];
+	dev[count].flags = flags;
+	return count++;
+} //add( )
+
+//--------------------------------------------------------------------------
+// Fill in the properties of a newly found device from its family
+// capabilities. Thermometers report their power mode with Read Power
+// Supply - a 0 read slot means parasite.
+//
+void DS2482table::probe( DS2482 &bridge, owdevice &d ) {
+	uint8_t caps = DS2482family::caps( d.rom[0] );
+
+	if( caps & OWC_OVERDRIVE ) d.flags |= OWD_OVERDRIVE;
+	if( caps & OWC_TEMP ) {
+		if( !bridge.OWReset( ) ) return;
+		bridge.OWWriteByte( 0x55 );		//match ROM
+		for( uint8_t kx=0; kx<8; kx++ ) bridge.OWWriteByte( d.rom[kx] );
+		bridge.OWWriteByte( 0xB4 );		//read power supply
+		if( bridge.OWReadBit( ) == 0 ) d.flags |= OWD_PARASITE;
+	}
+} //probe( )
+
+
+//--------------------------------------------------------------------------
+// Write the table image:
+//   TABLE_MAGIC  TABLE_VERSION  count  count x (rom[8], flags)  crc16
+//
+// 'put'  - writes one image byte at an address
+// 'base' - address of the image
+//
+// Returns:  number of bytes in the image
+//
+uint16_t DS2482table::save( owputb put, uint16_t base ) {
+	uint16_t adr = base;
+	uint16_t crc = 0;
+	uint8_t b;
+
+	b = TABLE_MAGIC;	put( adr++, b );	crc = DS2482::calc_crc16( crc, b );
+	b = TABLE_VERSION;	put( adr++, b );	crc = DS2482::calc_crc16( crc, b );
+	b = count;		put( adr++, b );	crc = DS2482::calc_crc16( crc, b );
+	for( uint8_t ix=0; ix<count; ix++ ) {
+		for( uint8_t kx=0; kx<8; kx++ ) {
+			b = dev[ix].rom[kx];
+			put( adr++, b );
+			crc = DS2482::calc_crc16( crc, b );
+		}
+		b = dev[ix].flags & ~OWD_SEEN;
+		put( adr++, b );
+		crc = DS2482::calc_crc16( crc, b );
+	}
+	crc = ~crc;
+	put( adr++, crc & 0xff );
+	put( adr++, crc >> 8 );
+	return adr - base;
+} //save( )
+
+//--------------------------------------------------------------------------
+// Read a table image written by save( ). The table is left empty unless
+// the image is intact and fits.
+//
+// Returns:  true: table loaded
+//           false: no image, wrong version, too many devices or bad crc
+//
+bool DS2482table::load( owgetb get, uint16_t base ) {
+	uint16_t adr = base;
+	uint16_t crc = 0;
+	uint8_t b;
+
+	count = 0;
+	searching = false;
+	whole = false;				//bus may have changed since saved
+	b = get( adr++ );
+	if( b != TABLE_MAGIC ) return false;
+	crc = DS2482::calc_crc16( crc, b );
+	b = get( adr++ );
+	if( b != TABLE_VERSION ) return false;
+	crc = DS2482::calc_crc16( crc, b );
+	uint8_t n = get( adr++ );
+	if( n > maxdev ) return false;
+	crc = DS2482::calc_crc16( crc, n );
+	for( uint8_t ix=0; ix<n; ix++ ) {
+		for( uint8_t kx=0; kx<8; kx++ ) {
+			b = get( adr++ );
+			dev[ix].rom[kx] = b;
+			crc = DS2482::calc_crc16( crc, b );
+		}
+		b = get( adr++ );
+		dev[ix].flags = b;
+		crc = DS2482::calc_crc16( crc, b );
+	}
+	crc = DS2482::calc_crc16( crc, get( adr++ ) );
+	crc = DS2482::calc_crc16( crc, get( adr++ ) );
+	if( crc != 0xB001 ) return false;		//residue with inverted crc appended
+	count = n;
+	return true;
+} //load( )
+
+//--------------------------------------------------------------------------
+// Warm start - load the saved table, bring up the bridge and check the bus
+// with one OWVerify of the first live device instead of a full
+// enumeration. Follow with discoverStep( ) calls when there is time.
+//
+// Returns:  true: table loaded and bus agrees, sampling can start
+//           false: cold start needed - bridge, bus or image not as saved
+//
+bool DS2482table::warmStart( DS2482 &bridge, owgetb get, uint16_t base ) {
+	if( !load( get, base ) ) return false;
+	if( !bridge.DS2482_detect( ) ) return false;
+	// OWVerify's search starts with a reset and fails without presence
+	for( uint8_t ix=0; ix<count; ix++ ) {
+		if( dev[ix].flags & OWD_GONE ) continue;
+		return bridge.OWVerify( dev[ix].rom );
+	}
+	return false;			//nothing live in the image
+} //warmStart( )
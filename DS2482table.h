@@ -0,0 +1,86 @@
+// DS2482table.h - one-wire device table with persistence for fast warm start
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised: Oct 19/26 - thermometer resolution kept in flags
+//          Oct 19/26 - upstream tables for coupler branches
+//          Oct 19/26 - which calls may run between discoverStep( )s
+//          Oct 19/26 - complete( )
+//
+//
+// The table holds the ROM number and a few property flags of each device
+// found on the bus; a device's index in the table is its handle. Storage is
+// supplied by the sketch.
+//
+// save( ) writes the table as a small image with a CRC16 through a byte
+// writer function - EEPROM.update on arduino, a file buffer on linux - and
+// load( ) reads it back through a byte reader. warmStart( ) loads the image,
+// brings up the bridge and verifies the bus quickly, so sampling can begin
+// without the full OWFirst/OWNext enumeration. The rediscovery is then done a
+// step at a time with discoverStep( ) between samples; handles stay fixed,
+// new devices are appended and devices no longer found are marked OWD_GONE.
+// Sampling between steps is fine, but not other searches on the same bridge
+// (OWFirst/OWNext, search( ) ranges, coupler discovery) - they take over the
+// search state the pass depends on; see discoverStep( ).
+//
+// A table for a coupler branch (DS2482coupler) points at the table of the
+// branch above it with 'upstream'; devices found there - always visible
+// through the switched coupler - are not added again.
+//
+#ifndef DS2482_TABLE_HDR
+#define DS2482_TABLE_HDR
+
+#include "DS2482.h"
+
+//device property flags
+#define OWD_PARASITE 0x01   //device runs on parasite power
+#define OWD_OVERDRIVE 0x02  //device supports overdrive speed
+#define OWD_RESMASK 0x0C    //thermometer resolution - 9 (DS2482temp)
+#define OWD_RESSHIFT 2
+#define OWD_CONFIG 0x10     //resolution field is valid
+#define OWD_GONE 0x40       //not found by last full rediscovery
+#define OWD_SEEN 0x80       //found in rediscovery pass in progress (not saved)
+
+//table image in EEPROM/flash/file
+#define TABLE_MAGIC 0xD7    //first byte of image
+#define TABLE_VERSION 1
+
+struct owdevice {
+	uint8_t rom[8];
+	uint8_t flags;
+};
+
+typedef void (*owputb)( uint16_t adr, uint8_t data );	//image byte writer
+typedef uint8_t (*owgetb)( uint16_t adr );		//image byte reader
+
+class DS2482table {
+
+public:
+	DS2482table( owdevice *devs, uint8_t _maxdev );	//table storage from caller
+
+	uint8_t discover( DS2482 &bridge );
+	bool discoverStep( DS2482 &bridge );
+	int find( const uint8_t *rom ) const;
+	bool inUpstream( const uint8_t *rom ) const;
+	bool complete( ) const;
+	int add( const uint8_t *rom, uint8_t flags );
+
+	uint16_t save( owputb put, uint16_t base );
+	bool load( owgetb get, uint16_t base );
+	bool warmStart( DS2482 &bridge, owgetb get, uint16_t base );
+
+	owdevice *dev;
+	uint8_t count;
+	const DS2482table *upstream;	//table of branch above, NULL for trunk
+
+private:
+	uint8_t maxdev;
+	bool searching;		//discoverStep pass in progress
+	bool whole;		//last pass found every device a place
+	bool dropped;		//device found with table full, this pass
+
+	void probe( DS2482 &bridge, owdevice &d );
+
+}; //class DS2482table
+
+#endif
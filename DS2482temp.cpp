@@ -0,0 +1,173 @@
+//DS2482temp.cpp - thermometer configuration across a device table
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - skip ROM copy only for a complete, all-changed bus
+//
+//
+
+#include "DS2482temp.h"
+#include "DS2482family.h"
+#include <string.h>
+
+static const uint8_t readPad[] PROGMEM = {
+	OWS_RESET, OWS_MATCH, OWS_WRITE( 1 ), TEMP_RSPAD, OWS_READ( TEMP_PADSZ ),
+	OWS_CRC8( TEMP_PADSZ ), OWS_END };
+static const uint8_t copyOne[] PROGMEM = {
+	OWS_RESET, OWS_MATCH, OWS_POWER( TEMP_COPY ), OWS_WAIT( TEMP_COPYMS ), OWS_LEVEL, OWS_END };
+static const uint8_t copyAll[] PROGMEM = {
+	OWS_RESET, OWS_SKIP, OWS_POWER( TEMP_COPY ), OWS_WAIT( TEMP_COPYMS ), OWS_LEVEL, OWS_END };
+
+DS2482temp::DS2482temp( DS2482 &bridge, DS2482table &table ) : ow( bridge ), tab( table ), ows( bridge ) {
+}//constructor
+
+
+// live thermometer in the table
+bool DS2482temp::isTemp( uint8_t handle ) {
+	if( handle >= tab.count || ( tab.dev[handle].flags & OWD_GONE ) ) return false;
+	return DS2482family::driver( tab.dev[handle].rom[0] ) == OWDRV_TEMP;
+} //isTemp( )
+
+//--------------------------------------------------------------------------
+// Read a thermometer's scratchpad and note its resolution in the table.
+// The DS18S20 has no configuration byte and is recorded as 12 bit (750 ms).
+//
+// 'handle' - device index in the table
+// 'pad'    - receives the TEMP_PADSZ scratchpad bytes; TH is pad[2], TL
+//            pad[3] and the configuration byte pad[4]
+//
+// Returns:  true: scratchpad read with good crc
+//           false: not a thermometer, no presence or crc error
+//
+bool DS2482temp::readConfig( uint8_t handle, uint8_t *pad ) {
+	if( !isTemp( handle ) ) return false;
+	owdevice &d = tab.dev[handle];
+	if( ows.run( readPad, d.rom, pad ) != OWS_DONE ) return false;
+	uint8_t res = ( d.rom[0] == 0x10 ) ? 3 : ( ( pad[4] >> 5 ) & 0x03 );
+	d.flags = ( d.flags & ~OWD_RESMASK ) | ( res << OWD_RESSHIFT ) | OWD_CONFIG;
+	return true;
+} //readConfig( )
+
+//--------------------------------------------------------------------------
+// Set resolution and alarm limits on every thermometer in the table.
+// Sensors whose scratchpad already matches are not written, and only the
+// sensors written are copied to EEPROM - one addressed Copy Scratchpad
+// each. A single skip ROM copy is used instead only when it can reach no
+// other device: the caller says the table's devices are alone on the bus,
+// the table is complete( ) and every one of them is a thermometer that was
+// changed.
+//
+// 'res'   - resolution (9-12 bits) for each handle, TEMP_KEEP to leave a
+//           sensor's resolution alone; NULL leaves all resolutions alone
+// 'th'    - high alarm limit, degrees C
+// 'tl'    - low alarm limit, degrees C
+// 'alone' - true: no devices on the bus but those in the table (no other
+//           table, no switched coupler branch)
+//
+// Returns:  number of sensors changed
+//           -1: a sensor could not be read or a copy failed
+//
+int DS2482temp::configure( const uint8_t *res, int8_t th, int8_t tl, bool alone ) {
+	return apply( res, TEMP_KEEP, th, tl, alone );
+} //configure( )
+
+// same resolution for every sensor - see configure( )
+int DS2482temp::configureAll( uint8_t res, int8_t th, int8_t tl, bool alone ) {
+	return apply( NULL, res, th, tl, alone );
+} //configureAll( )
+
+// resolution from 'res' per handle if given, else 'allres' for every sensor
+int DS2482temp::apply( const uint8_t *res, uint8_t allres, int8_t th, int8_t tl, bool alone ) {
+	uint8_t chg[32];		//changed handles, a bit each
+	bool skip = alone && tab.complete( );
+	int changed = 0;
+	int ntemp = 0;
+
+	memset( chg, 0, sizeof( chg ) );
+	for( uint8_t ix=0; ix<tab.count; ix++ ) {
+		if( !isTemp( ix ) ) {
+			if( !( tab.dev[ix].flags & OWD_GONE ) ) skip = false;	//other family
+			continue;
+		}
+		ntemp++;
+		int rc = update( ix, res ? res[ix] : allres, th, tl );
+		if( rc < 0 ) return -1;
+		if( rc == 0 ) continue;
+		chg[ix >> 3] |= 1 << ( ix & 7 );
+		changed++;
+	}
+	if( changed == 0 ) return 0;
+
+	// every device on the bus is a changed thermometer - one copy for all
+	if( skip && changed == ntemp ) return copy( NULL ) ? changed : -1;
+
+	for( uint8_t ix=0; ix<tab.count; ix++ ) {
+		if( ( chg[ix >> 3] & ( 1 << ( ix & 7 ) ) ) && !copy( tab.dev[ix].rom ) ) return -1;
+	}
+	return changed;
+} //apply( )
+
+//--------------------------------------------------------------------------
+// Write one sensor's scratchpad if it differs from what is wanted.
+//
+// Returns:  1: written, 0: already matched, -1: read failed
+//
+int DS2482temp::update( uint8_t handle, uint8_t res, int8_t th, int8_t tl ) {
+	uint8_t pad[TEMP_PADSZ];
+	owdevice &d = tab.dev[handle];
+	bool hascfg = d.rom[0] != 0x10;
+
+	if( !readConfig( handle, pad ) ) return -1;
+	uint8_t cfg = pad[4];
+	if( hascfg && res >= 9 && res <= 12 ) cfg = ( ( res - 9 ) << 5 ) | 0x1F;
+	if( pad[2] == (uint8_t)th && pad[3] == (uint8_t)tl && ( !hascfg || pad[4] == cfg ) ) return 0;
+
+	if( !ow.OWReset( ) ) return -1;
+	ow.OWWriteByte( 0x55 );			//match ROM
+	for( uint8_t kx=0; kx<8; kx++ ) ow.OWWriteByte( d.rom[kx] );
+	ow.OWWriteByte( TEMP_WSPAD );
+	ow.OWWriteByte( (uint8_t)th );
+	ow.OWWriteByte( (uint8_t)tl );
+	if( hascfg ) {
+		ow.OWWriteByte( cfg );
+		d.flags = ( d.flags & ~OWD_RESMASK ) | ( ( ( cfg >> 5 ) & 0x03 ) << OWD_RESSHIFT ) | OWD_CONFIG;
+	}
+	return 1;
+} //update( )
+
+// Copy Scratchpad under strong pullup; rom NULL - all sensors via skip ROM
+bool DS2482temp::copy( const uint8_t *rom ) {
+	return ows.run( rom ? copyOne : copyAll, rom, NULL ) == OWS_DONE;
+} //copy( )
+
+
+// Returns: resolution in bits, 0 if not yet read
+uint8_t DS2482temp::resolution( uint8_t handle ) {
+	if( handle >= tab.count || !( tab.dev[handle].flags & OWD_CONFIG ) ) return 0;
+	return 9 + ( ( tab.dev[handle].flags & OWD_RESMASK ) >> OWD_RESSHIFT );
+} //resolution( )
+
+// Returns: conversion time for the sensor, ms; 750 if resolution unknown
+uint16_t DS2482temp::convTime( uint8_t handle ) {
+	uint8_t res = resolution( handle );
+	return resTime( res ? res : 12 );
+} //convTime( )
+
+// Returns: conversion time for a skip ROM convert of all live sensors, ms
+uint16_t DS2482temp::maxConvTime( ) {
+	uint16_t ms = 0;
+	for( uint8_t ix=0; ix<tab.count; ix++ ) {
+		if( isTemp( ix ) && convTime( ix ) > ms ) ms = convTime( ix );
+	}
+	return ms;
+} //maxConvTime( )
+
+// Returns: DS18B20 maximum conversion time for 'bits' resolution, ms
+uint16_t DS2482temp::resTime( uint8_t bits ) {
+	switch( bits ) {
+	case 9:  return 94;
+	case 10: return 188;
+	case 11: return 375;
+	default: return 750;
+	}
+} //resTime( )
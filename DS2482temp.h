@@ -0,0 +1,61 @@
+// DS2482temp.h - DS18B20 family resolution and alarm configuration for a device table
+//
+// Started: Oct 19, 2026  DS2482 library contributors
+//
+// Revised: Oct 19/26 - skip ROM copy only when it reaches no other device
+//
+//
+// Conversion time grows with resolution: 94 ms at 9 bits up to 750 ms at 12
+// bits, so choosing each sensor's resolution is how a logger trades precision
+// for cycle rate. configure( ) reads each thermometer's scratchpad, writes the
+// scratchpad only where TH, TL or the configuration byte differ, and copies
+// just those sensors to EEPROM with an addressed Copy Scratchpad under strong
+// pullup. One Skip ROM copy replaces them only when the caller says the table
+// is alone on the bus, the table is complete( ) and every device in it is a
+// changed thermometer - a skip ROM 0x48 reaches every device on the bus. The
+// resolution found or set is kept in the table flags (and so saved with the
+// table) and convTime( ) gives the conversion time to wait.
+//
+#ifndef DS2482_TEMP_HDR
+#define DS2482_TEMP_HDR
+
+#include "DS2482.h"
+#include "DS2482table.h"
+#include "DS2482script.h"
+
+//thermometer function commands
+#define TEMP_CONVERT 0x44   //convert temperature
+#define TEMP_WSPAD 0x4E     //write scratchpad
+#define TEMP_RSPAD 0xBE     //read scratchpad
+#define TEMP_COPY 0x48      //copy scratchpad to EEPROM
+#define TEMP_COPYMS 10      //EEPROM copy time
+
+#define TEMP_PADSZ 9        //scratchpad bytes including crc
+#define TEMP_KEEP 0         //resolution argument - leave as is
+
+class DS2482temp {
+
+public:
+	DS2482temp( DS2482 &bridge, DS2482table &table );
+
+	bool readConfig( uint8_t handle, uint8_t *pad );
+	int configure( const uint8_t *res, int8_t th, int8_t tl, bool alone = false );
+	int configureAll( uint8_t res, int8_t th, int8_t tl, bool alone = false );
+	uint8_t resolution( uint8_t handle );
+	uint16_t convTime( uint8_t handle );
+	uint16_t maxConvTime( );
+	static uint16_t resTime( uint8_t bits );
+
+private:
+	DS2482 &ow;
+	DS2482table &tab;
+	DS2482script ows;
+
+	bool isTemp( uint8_t handle );
+	int apply( const uint8_t *res, uint8_t allres, int8_t th, int8_t tl, bool alone );
+	int update( uint8_t handle, uint8_t res, int8_t th, int8_t tl );
+	bool copy( const uint8_t *rom );
+
+}; //class DS2482temp
+
+#endif
@@ -0,0 +1,55 @@
+//bridgeScan - example for DS2482 library bridge discovery:
+//           - find all DS2482 bridges on the I2C bus, whatever their
+//             addresses, and bring them up in one pass
+//           - tell DS2482-100 from DS2482-800
+//           - count the one-wire devices on each bridge channel
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised:
+//
+
+#include <Wire.h>
+#include "DS2482.h"       //package of AN3684 subr
+
+DS2482 bridges[DS2482_MAXBRIDGE];   //addresses filled in by discovery
+uint8_t nbridge;
+
+void setup() {
+  Serial.begin( 9600 );
+  while( !Serial ) { /* wait */ }
+  Wire.begin( );
+  Serial.println( "bridgeScan - DS2482 bridges" );
+
+  unsigned long start = micros( );
+  nbridge = DS2482::DS2482_discover( bridges, DS2482_MAXBRIDGE );
+  unsigned long took = micros( ) - start;
+
+  Serial.print( nbridge );
+  Serial.print( " bridges ready in " );
+  Serial.print( took );
+  Serial.println( " us" );
+
+  for( uint8_t ix=0; ix<nbridge; ix++ ) {
+    DS2482 &ow = bridges[ix];
+    Serial.print( "I2Cadr " );
+    Serial.print( ow.address( ), HEX );
+    Serial.println( ow.channels == 8 ? " DS2482-800" : " DS2482-100" );
+    for( uint8_t ch=0; ch<ow.channels; ch++ ) {
+      if( !ow.DS2482_channel_select( ch ) ) continue;
+      uint8_t n = 0;
+      for( const auto &rom : ow.search( ) ) {
+        (void)rom;
+        n++;
+      }
+      Serial.print( "  channel " );
+      Serial.print( ch );
+      Serial.print( ": " );
+      Serial.print( n );
+      Serial.println( " devices" );
+    }
+  }
+} //setup( )
+
+void loop( ) {
+}
@@ -0,0 +1,83 @@
+//couplerTree - example for DS2482 library DS2409 coupler support:
+//           - discover a network of couplers and the devices on each branch
+//           - print the tree
+//           - convert on each branch in turn, connecting only that branch
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - report couplers left without a branch
+//
+
+#include <Wire.h>
+#include "DS2482.h"         //package of AN3684 subr
+#include "DS2482table.h"    //device table
+#include "DS2482coupler.h"  //coupler branches
+#include "DS2482family.h"   //family names
+
+#define I2Cadr 0x18       //base address of DS2482
+#define MAXBR 5           //trunk and two couplers' outputs
+#define MAXID 8           //maximum number of devices per branch
+
+DS2482 i2ow( I2Cadr );    //create bridge object on I2C address 0x18
+
+owdevice devs[MAXBR][MAXID];
+DS2482table tables[MAXBR] = {
+  DS2482table( devs[0], MAXID ), DS2482table( devs[1], MAXID ),
+  DS2482table( devs[2], MAXID ), DS2482table( devs[3], MAXID ),
+  DS2482table( devs[4], MAXID ) };
+owbranch branches[MAXBR] = {
+  { &tables[0] }, { &tables[1] }, { &tables[2] }, { &tables[3] }, { &tables[4] } };
+DS2482coupler net( i2ow, branches, MAXBR );
+
+void printRom( const uint8_t *rom ) {
+  for( byte kx=7; kx<8; kx-- ) {
+    if( rom[kx] < 0x10 ) Serial.print( '0' );
+    Serial.print( rom[kx], HEX );
+  }
+}
+
+void setup() {
+  Serial.begin( 9600 );
+  while( !Serial ) { /* wait */ }
+  Wire.begin( );
+  i2ow.begin( );
+  Serial.println( "couplerTree - DS2482 bridge" );
+  if( !i2ow.DS2482_detect( ) ) {
+    Serial.print( "error accessing bridge chip at I2Cadr " );
+    Serial.println( I2Cadr, HEX );
+  }
+
+  net.discover( );
+  if( !net.complete( ) ) Serial.println( "branch table full - raise MAXBR" );
+  for( byte b=0; b<net.count; b++ ) {
+    Serial.print( "branch " );
+    Serial.print( b );
+    if( b != OWB_TRUNK ) {
+      Serial.print( " - " );
+      Serial.print( branches[b].channel == CPL_MAIN ? "main of " : "aux of " );
+      printRom( tables[branches[b].parent].dev[branches[b].coupler].rom );
+    }
+    Serial.println( );
+    for( byte ix=0; ix<tables[b].count; ix++ ) {
+      Serial.print( "  " );
+      printRom( tables[b].dev[ix].rom );
+      const char *desc = DS2482family::desc( tables[b].dev[ix].rom[0] );
+      Serial.print( ' ' );
+      if( desc ) Serial.println( (const __FlashStringHelper *)desc );
+      else Serial.println( );
+    }
+  }
+} //setup( )
+
+void loop( ) {
+  for( byte b=0; b<net.count; b++ ) {
+    if( !net.select( b ) ) continue;
+    i2ow.OWReset( );
+    i2ow.OWWriteByte( 0xCC );         //skip ROM - this branch (and trunk) only
+    i2ow.OWWriteBytePower( 0x44 );    //convert T
+    delay( 750 );
+    i2ow.OWLevel( MODE_STANDARD );
+    //... read each thermometer in tables[b] as in i2cTemps
+  }
+  delay( 5000 );
+}
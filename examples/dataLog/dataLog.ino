@@ -0,0 +1,95 @@
+//dataLog - example for DS2482 library sample log:
+//           - search the one-wire bus for DS18B20 sensors
+//           - read all temperatures once a minute into the sample ring
+//           - encode full blocks and append them to EEPROM
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - scratchpad read and crc check by script
+//
+
+#include <Wire.h>
+#include <EEPROM.h>
+#include "DS2482.h"     //package of AN3684 subr
+#include "DS2482log.h"  //sample ring and log blocks
+#include "DS2482script.h" //scratchpad read script
+#include "oneWire.h"    //DS18B20 definitions
+
+#define I2Cadr 0x18     //base address of DS2482
+#define MAXID 6         //maximum number of one-wire serial numbers
+#define RINGSZ 24       //samples held in RAM
+#define BLKSZ 48        //log block size written to EEPROM
+#define PERIOD 60000UL  //ms between sweeps
+
+DS2482 i2ow( I2Cadr );  //create bridge object on I2C address 0x18
+DS2482script ows( i2ow );
+
+//scratchpad read; OWS_CRC8 starts its crc from 0 on every read
+const uint8_t readPad[] PROGMEM = {
+  OWS_RESET, OWS_MATCH, OWS_WRITE( 1 ), CRSPD, OWS_READ( 9 ), OWS_CRC8( 9 ),
+  OWS_END };
+
+byte sna[MAXID][8];     //storage for discovered one-wire devices
+byte nsna = 0;
+
+owsample ring[RINGSZ];
+DS2482log samples( ring, RINGSZ );
+byte blk[BLKSZ];
+int eeadr = 0;          //next free EEPROM location
+
+byte pad[9];            //scratchpad
+
+void setup() {
+  Serial.begin( 9600 );
+  while( !Serial ) { /* wait */ }
+  Wire.begin( );
+  i2ow.begin( );
+  Serial.println( "dataLog - DS2482 bridge" );
+  if( !i2ow.DS2482_detect( ) ) {
+    Serial.print( "error accessing bridge chip at I2Cadr " );
+    Serial.println( I2Cadr, HEX );
+  }
+
+  //search ROM for temperature sensors
+  bool more = i2ow.OWFirst( );
+  while( more && nsna<MAXID ) {
+    if( i2ow.ROM_NO[0] == 0x28 ) {
+      for( byte ix=0; ix<8; ix++ ) sna[nsna][ix] = i2ow.ROM_NO[ix];
+      nsna++;
+    }
+    more = i2ow.OWNext( );
+  }
+  Serial.print( nsna );
+  Serial.println( " sensors" );
+} //setup( )
+
+
+void loop() {
+  static unsigned long last = 0;
+  if( nsna == 0 || millis( ) - last < PERIOD ) return;
+  last = millis( );
+
+  //convert all, with power
+  i2ow.OWReset( );
+  i2ow.OWWriteByte( CSKRM );
+  i2ow.OWWriteBytePower( CCVRT );
+  delay( 750 );
+  i2ow.OWLevel( MODE_STANDARD );
+
+  //raw readings go straight into the ring - no formatting
+  for( byte kx=0; kx<nsna; kx++ ) {
+    //a missing sensor or bad read skips this sample only
+    if( ows.run( readPad, sna[kx], pad ) == OWS_DONE ) {
+      samples.put( kx, last / 1000, ( (int)pad[1]<<8 ) + pad[0] );
+    }
+  }
+
+  //flush a block when the ring is getting full
+  if( samples.count( ) >= RINGSZ - nsna ) {
+    int len = samples.encode( blk, BLKSZ );
+    if( eeadr + len > (int)EEPROM.length( ) ) eeadr = 0;   //wrap the log
+    for( int ix=0; ix<len; ix++ ) EEPROM.update( eeadr++, blk[ix] );
+    Serial.print( len );
+    Serial.println( " byte block logged" );
+  }
+} //loop( )
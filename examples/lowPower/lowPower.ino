@@ -0,0 +1,76 @@
+//lowPower - example for DS2482 library suspend and resume:
+//           - power the bridge and sensors from a pin, off between samples
+//           - on wake, restore the bridge from its cached state with a
+//             status read instead of DS2482_detect, keep the device table
+//             in RAM and go straight to sampling
+//           - report the awake time of each sample cycle
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - same power-up settle time before resume as before detect
+//
+
+#include <Wire.h>
+#include "DS2482.h"       //package of AN3684 subr
+#include "DS2482table.h"  //device table
+#include "DS2482temp.h"   //thermometer configuration
+#include "oneWire.h"      //DS18B20 definitions
+
+#define I2Cadr 0x18       //base address of DS2482
+#define MAXID 8           //maximum number of one-wire devices
+#define PWRPIN 7          //high powers bridge and sensors (LV switch)
+#define SLEEPMS 10000     //time between samples
+#define PWRMS 10          //supply settle time after power-up
+
+DS2482 i2ow( I2Cadr );    //create bridge object on I2C address 0x18
+
+owdevice devs[MAXID];
+DS2482table table( devs, MAXID );
+DS2482temp temps( i2ow, table );
+DS2482state bridge;       //bridge state kept while powered down
+
+void setup() {
+  Serial.begin( 9600 );
+  while( !Serial ) { /* wait */ }
+  pinMode( PWRPIN, OUTPUT );
+  digitalWrite( PWRPIN, HIGH );
+  delay( PWRMS );
+  Wire.begin( );
+  i2ow.begin( );
+  Serial.println( "lowPower - DS2482 bridge" );
+  if( !i2ow.DS2482_detect( ) ) {
+    Serial.print( "error accessing bridge chip at I2Cadr " );
+    Serial.println( I2Cadr, HEX );
+  }
+  table.discover( i2ow );
+  temps.configureAll( TEMP_KEEP, 60, -10 );    //alarm limits; notes resolutions
+  Serial.print( table.count );
+  Serial.println( " devices" );
+  bridge = i2ow.suspend( );
+  digitalWrite( PWRPIN, LOW );
+} //setup( )
+
+void loop( ) {
+  digitalWrite( PWRPIN, HIGH );
+  unsigned long start = micros( );
+  delay( PWRMS );                            //bridge answers only once powered
+
+  bool ok = i2ow.resume( bridge );
+  if( !ok ) ok = i2ow.DS2482_detect( );      //full bring-up only if needed
+  if( ok && i2ow.OWReset( ) ) {
+    i2ow.OWWriteByte( CSKRM );
+    i2ow.OWWriteBytePower( CCVRT );
+    delay( temps.maxConvTime( ) );
+    i2ow.OWLevel( MODE_STANDARD );
+    //... read each device in table.dev[ ] as in i2cTemps
+  }
+
+  bridge = i2ow.suspend( );
+  unsigned long awake = micros( ) - start;
+  digitalWrite( PWRPIN, LOW );
+
+  Serial.print( ok ? "sampled, awake " : "bridge not restored, awake " );
+  Serial.print( awake );
+  Serial.println( " us" );
+  delay( SLEEPMS );                          //or put the processor to sleep
+}
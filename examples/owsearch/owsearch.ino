@@ -3,7 +3,7 @@
 //
 // started: Jan 21, 2022  G. D. (Joe) Young <jyoung@islandnet.com>
 //
-// revised:
+// revised: Oct 19, 2026 - use range-for search in place of OWFirst/OWNext loop
 //
 
 #include <Wire.h>
@@ -18,7 +18,6 @@ DS2482 i2ow( I2Cadr ); //create bridge object on I2C address 0x18
 byte sna[MAXID][8];   //storage for discovered one-wire devices
 
 byte tmpMem[25];      //command string buffer
-bool found = false;
 
 void setup() {
   Serial.begin( 9600 );
@@ -51,19 +50,10 @@ void setup() {
   Serial.println( "search ROM" );
   //search ROM with indefinite number of devices, up to MAXID
   byte jx = 0;
-  if( i2ow.OWFirst( ) ) {
-    found = true;
-    for( byte ix=0; ix<8; ix++ ) sna[jx][ix] = i2ow.ROM_NO[ix];    //copy found to save area
-    jx++;
-    while( found && jx<MAXID ) {
-      if( i2ow.OWNext( ) ) {
-        for( byte ix=0; ix<8; ix++ ) sna[jx][ix] = i2ow.ROM_NO[ix];
-        jx++;
-      } else {
-        found = false;
-      }
-    } // while finding devices (fewer than MAXID)
-  } // if first
+  for( const owrom &rom : i2ow.search( ) ) {
+    for( byte ix=0; ix<8; ix++ ) sna[jx][ix] = rom[ix];    //copy found to save area
+    if( ++jx == MAXID ) break;          //table full - search state is cleared
+  } // for each device found
   if( jx == 0 ) {
     Serial.println( "no one-wire devices found" );
   } else {
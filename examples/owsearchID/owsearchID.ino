@@ -4,11 +4,12 @@
 // started: Jan 21, 2022  G. D. (Joe) Young <jyoung@islandnet.com>
 //
 // revised: Feb  6, 2022 - add table of some one-wire family ID, lookup found devices
+//          Oct 19, 2026 - use library family registry in place of owIDtable.h
 //
 
 #include <Wire.h>
 #include "DS2482.h"   //package of AN3684 subr
-#include "owIDtable.h" //table of one-wire device descriptions
+#include "DS2482family.h" //table of one-wire family descriptions
 
 //#define I2Cadr 0x18   //base address of DS2482
 #define I2Cadr 0x19   //next address of DS2482 AD0 = 1, AD1 = 0
@@ -75,14 +76,12 @@ void setup() {
         }
       
       Serial.println( "" );
-      bool idfound = false;
-      for( byte idx=0; idx<NRID; idx++ ) {    //look for id description
-        if( sna[ix][0] == idlist[idx] ) {
-          displayID( idx );
-          idfound = true;
-        } //if found
-      } //loop over table
-      if( !idfound ) {
+      const char *desc = DS2482family::desc( sna[ix][0] );    //look for id description
+      if( desc ) {
+        Serial.print( sna[ix][0], HEX );
+        Serial.print( ' ' );
+        Serial.println( (const __FlashStringHelper *)desc );
+      } else {
         Serial.println( " * description not found" );
       } // if description of this device is in table of descriptions
     }
@@ -0,0 +1,100 @@
+//pioStream - example for DS2482 library channel-access streaming:
+//           - find the first DS2408 (or DS2413) switch on the bus
+//           - stream PIO samples with Channel-Access Read
+//           - report the sustained sample rate
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised:
+//
+
+#include <Wire.h>
+#include "DS2482.h"     //package of AN3684 subr
+#include "DS2482pio.h"  //DS2408/DS2413 channel access
+
+#define I2Cadr 0x18     //base address of DS2482
+#define NSAMP 1000      //samples per timed run
+
+DS2482 i2ow( I2Cadr );  //create bridge object on I2C address 0x18
+DS2482pio pio( i2ow );  //switch streams through the bridge
+
+byte rom[8];            //serial number of switch found
+byte samples[64];       //sample buffer
+bool found = false;
+
+void setup() {
+  Serial.begin( 9600 );
+  while( !Serial ) { /* wait */ }
+  Wire.begin( );
+  i2ow.begin( );
+  Serial.println( "pioStream - DS2482 bridge" );
+  if( !i2ow.DS2482_detect( ) ) {
+    Serial.print( "error accessing bridge chip at I2Cadr " );
+    Serial.println( I2Cadr, HEX );
+    return;
+  }
+
+  //look for a switch
+  bool more = i2ow.OWFirst( );
+  while( more && !found ) {
+    if( i2ow.ROM_NO[0] == DS2408_FAMILY || i2ow.ROM_NO[0] == DS2413_FAMILY ) {
+      for( byte ix=0; ix<8; ix++ ) rom[ix] = i2ow.ROM_NO[ix];
+      found = true;
+    } else {
+      more = i2ow.OWNext( );
+    }
+  }
+  if( !found ) {
+    Serial.println( "no DS2408 or DS2413 found" );
+    return;
+  }
+
+  //timed read stream
+  if( !pio.readBegin( rom ) ) {
+    Serial.println( "no presence" );
+    return;
+  }
+  unsigned long start = millis( );
+  int total = 0;
+  int n = 0;
+  while( total < NSAMP ) {
+    n = pio.readSamples( samples, sizeof( samples ) );
+    total += n;
+    if( pio.crc_error ) {
+      Serial.println( "crc error - restarting stream" );
+      pio.end( );
+      pio.readBegin( rom );
+    }
+  }
+  unsigned long elapsed = millis( ) - start;
+  pio.end( );
+
+  if( n > 0 ) {
+    Serial.print( "last sample " );
+    Serial.println( samples[n-1], HEX );
+  }
+  Serial.print( total );
+  Serial.print( " samples in " );
+  Serial.print( elapsed );
+  Serial.println( " ms" );
+  if( elapsed ) {
+    Serial.print( ( total * 1000UL ) / elapsed );
+    Serial.println( " samples/s" );
+  }
+
+  //write stream - walk a zero across the outputs, check confirmations
+  if( pio.writeBegin( rom ) ) {
+    byte state;
+    for( byte ix=0; ix<8; ix++ ) {
+      if( !pio.writeSample( ~( 1<<ix ), &state ) ) {
+        Serial.println( "write not confirmed" );
+        break;
+      }
+    }
+    pio.end( );
+  }
+} //setup( )
+
+void loop( ) {
+
+}
@@ -0,0 +1,118 @@
+//queueBench - linux example for DS2482queue: time 1-wire transactions from
+//           1, 2, 4 and 8 submitting threads sharing one bridge
+//           - through the queue (lock-free submit, one bus-owner worker)
+//           - through a mutex around the bridge, for comparison
+//           and print transactions per second and the time each submitting
+//           thread is held up per transaction
+//
+// Not an arduino sketch - build on the gateway against its Wire port, e.g.
+//   g++ -std=c++11 -O2 -pthread -I../.. -I<wire port> queueBench.cpp
+//     ../../DS2482.cpp ../../DS2482queue.cpp <wire port sources> -o queueBench
+//
+// or, with no bridge, against the simulated bus in sim/ (1-wire bus times
+// only, no I2C time), from this directory:
+//   g++ -std=c++11 -O2 -pthread -I../.. -Isim queueBench.cpp sim/simbus.cpp
+//     ../../DS2482.cpp ../../DS2482queue.cpp -o queueBench
+//
+// The bus is the bottleneck, so both level off at the bus rate. The
+// difference is in the submitting threads: with the mutex each one waits for
+// the bus, and for every thread ahead of it, on each transaction; with the
+// queue it spends only the enqueue and collects the results when it needs
+// them, while the worker runs the transactions back-to-back.
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised: Oct 19/26 - simulated bus build in sim/
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "DS2482.h"
+#include "DS2482queue.h"
+
+#define I2Cadr 0x18       //base address of DS2482
+#define JOBS 200          //transactions per submitting thread
+
+typedef std::chrono::steady_clock clk;
+
+DS2482 i2ow( I2Cadr );
+
+// one short transaction - reset and read a byte
+static uint8_t transaction( DS2482 &ow ) {
+	ow.OWReset( );
+	return ow.OWReadByte( );
+}
+
+static double seconds( clk::time_point t0 ) {
+	return std::chrono::duration<double>( clk::now( ) - t0 ).count( );
+}
+
+// 'held' - total seconds the submitting threads spent in submit calls
+static void report( const char *how, int nthreads, double secs, double held ) {
+	double total = (double)nthreads * JOBS;
+	printf( "%-6s %d threads: %8.0f transactions/s, thread held %8.1f us per transaction\n",
+		how, nthreads, total / secs, held * 1e6 / total );
+}
+
+static void addTime( std::atomic<long long> &sum, clk::time_point t0 ) {
+	sum += std::chrono::duration_cast<std::chrono::nanoseconds>( clk::now( ) - t0 ).count( );
+}
+
+static void viaQueue( int nthreads ) {
+	DS2482queue q( i2ow );
+	std::vector<std::thread> producers;
+	std::atomic<long long> held( 0 );
+
+	q.begin( );
+	clk::time_point t0 = clk::now( );
+	for( int t=0; t<nthreads; t++ ) {
+		producers.push_back( std::thread( [&q, &held] {
+			std::vector<std::future<uint8_t> > results;
+			clk::time_point s0 = clk::now( );
+			for( int j=0; j<JOBS; j++ ) results.push_back( q.submit( transaction ) );
+			addTime( held, s0 );
+			for( auto &r : results ) r.get( );
+		} ) );
+	}
+	for( auto &p : producers ) p.join( );
+	report( "queue", nthreads, seconds( t0 ), held * 1e-9 );
+	q.end( );
+}
+
+static void viaMutex( int nthreads ) {
+	std::mutex bus;
+	std::vector<std::thread> producers;
+	std::atomic<long long> held( 0 );
+
+	clk::time_point t0 = clk::now( );
+	for( int t=0; t<nthreads; t++ ) {
+		producers.push_back( std::thread( [&bus, &held] {
+			clk::time_point s0 = clk::now( );
+			for( int j=0; j<JOBS; j++ ) {
+				std::lock_guard<std::mutex> lk( bus );
+				transaction( i2ow );
+			}
+			addTime( held, s0 );
+		} ) );
+	}
+	for( auto &p : producers ) p.join( );
+	report( "mutex", nthreads, seconds( t0 ), held * 1e-9 );
+}
+
+int main( ) {
+	Wire.begin( );
+	if( !i2ow.DS2482_detect( ) ) {
+		printf( "error accessing bridge chip at I2Cadr %x\n", I2Cadr );
+		return 1;
+	}
+	for( int n=1; n<=8; n*=2 ) {
+		viaMutex( n );
+		viaQueue( n );
+	}
+	return 0;
+}
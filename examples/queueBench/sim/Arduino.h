@@ -0,0 +1,19 @@
+// Arduino.h - just enough of the arduino core for DS2482.cpp on a host,
+// used only by the queueBench simulated bus build
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+#ifndef SIM_ARDUINO_HDR
+#define SIM_ARDUINO_HDR
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte( p ) ( *(const uint8_t *)( p ) )
+
+unsigned long millis( );
+void delay( unsigned long ms );
+
+#endif
@@ -0,0 +1,26 @@
+// Wire.h - simulated I2C bus with one DS2482 and a bare 1-wire bus, used only
+// by the queueBench simulated bus build
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+#ifndef SIM_WIRE_HDR
+#define SIM_WIRE_HDR
+
+#include <stdint.h>
+#include <stddef.h>
+
+class TwoWire {
+
+public:
+	void begin( );
+	void beginTransmission( int adr );
+	size_t write( uint8_t b );
+	uint8_t endTransmission( bool stop = true );
+	uint8_t requestFrom( int adr, int n );
+	int read( );
+
+}; //class TwoWire
+
+extern TwoWire Wire;
+
+#endif
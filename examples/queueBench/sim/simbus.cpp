@@ -0,0 +1,72 @@
+//simbus.cpp - simulated DS2482 for the queueBench host build
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// Each 1-wire command holds the calling thread for its standard speed bus
+// time - reset 1148 us, byte 584 us, triplet 219 us, bit 73 us - and then
+// reports not busy, so owwait( ) needs no further polls. I2C transfer time
+// is not modelled. A device answers every reset; reads return 0xFF.
+//
+
+#include <chrono>
+#include <thread>
+#include "Arduino.h"
+#include "Wire.h"
+
+TwoWire Wire;
+
+static uint8_t cmd[2];
+static int ncmd;
+static uint8_t readptr = 0xF0;
+static uint8_t status = 0x18, config = 0, data = 0xFF;
+
+static void busTime( int us ) {
+	std::this_thread::sleep_for( std::chrono::microseconds( us ) );
+}
+
+unsigned long millis( ) {
+	using namespace std::chrono;
+	return duration_cast<milliseconds>( steady_clock::now( ).time_since_epoch( ) ).count( );
+}
+
+void delay( unsigned long ms ) {
+	std::this_thread::sleep_for( std::chrono::milliseconds( ms ) );
+}
+
+void TwoWire::begin( ) {
+}
+
+void TwoWire::beginTransmission( int ) {
+	ncmd = 0;
+}
+
+size_t TwoWire::write( uint8_t b ) {
+	if( ncmd < 2 ) cmd[ncmd++] = b;
+	return 1;
+}
+
+uint8_t TwoWire::endTransmission( bool ) {
+	if( ncmd == 0 ) return 0;
+	readptr = 0xF0;
+	switch( cmd[0] ) {
+	case 0xF0:	status = 0x18; config = 0; break;		//device reset
+	case 0xD2:	config = cmd[1] & 0x0F; readptr = 0xC3; break;	//write config
+	case 0xE1:	readptr = cmd[1]; break;			//set read pointer
+	case 0xB4:	busTime( 1148 ); status = 0x02; break;		//reset, presence
+	case 0xA5:	busTime( 584 ); status = 0; break;		//write byte
+	case 0x96:	busTime( 584 ); status = 0; data = 0xFF; break;	//read byte
+	case 0x87:	busTime( 73 ); status = 0x20; break;		//single bit, 1
+	case 0x78:	busTime( 219 ); status = 0x60; break;		//triplet, no device
+	}
+	return 0;
+}
+
+uint8_t TwoWire::requestFrom( int, int ) {
+	return 1;
+}
+
+int TwoWire::read( ) {
+	if( readptr == 0xE1 ) return data;
+	if( readptr == 0xC3 ) return config;
+	return status;
+}
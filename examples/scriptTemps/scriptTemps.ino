@@ -0,0 +1,70 @@
+//scriptTemps - example for DS2482 library transaction scripts:
+//           - DS18B20 convert and read protocols written as scripts
+//           - conversion run without blocking, reads run blocking
+//           - display raw temperatures
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised:
+//
+
+#include <Wire.h>
+#include "DS2482.h"        //package of AN3684 subr
+#include "DS2482script.h"  //1-wire transaction scripts
+#include "oneWire.h"       //DS18B20 definitions
+
+#define I2Cadr 0x18        //base address of DS2482
+#define MAXID 6            //maximum number of one-wire serial numbers
+
+DS2482 i2ow( I2Cadr );     //create bridge object on I2C address 0x18
+DS2482script ows( i2ow );  //script interpreter on the bridge
+
+//all sensors convert under strong pullup
+const uint8_t convertAll[] PROGMEM = {
+  OWS_RESET, OWS_SKIP, OWS_POWER( CCVRT ), OWS_WAIT( 750 ), OWS_LEVEL, OWS_END };
+//read one sensor's scratchpad, check crc
+const uint8_t readPad[] PROGMEM = {
+  OWS_RESET, OWS_MATCH, OWS_WRITE( 1 ), CRSPD, OWS_READ( 9 ), OWS_CRC8( 9 ), OWS_END };
+
+byte sna[MAXID][8];        //storage for discovered one-wire devices
+byte nsna = 0;
+byte pad[9];               //scratchpad
+
+void setup() {
+  Serial.begin( 9600 );
+  while( !Serial ) { /* wait */ }
+  Wire.begin( );
+  i2ow.begin( );
+  Serial.println( "scriptTemps - DS2482 bridge" );
+  if( !i2ow.DS2482_detect( ) ) {
+    Serial.print( "error accessing bridge chip at I2Cadr " );
+    Serial.println( I2Cadr, HEX );
+  }
+  if( DS2482script::validate( convertAll, 0 ) < 0 || DS2482script::validate( readPad, sizeof( pad ) ) < 0 ) {
+    Serial.println( "bad script" );
+  }
+  for( const owrom &rom : i2ow.search( 0x28 ) ) {
+    for( byte ix=0; ix<8; ix++ ) sna[nsna][ix] = rom[ix];
+    if( ++nsna == MAXID ) break;
+  }
+  ows.start( convertAll, NULL, NULL );
+} //setup( )
+
+void loop( ) {
+  int rslt = ows.step( );          //returns at once while the conversion runs
+  if( rslt == OWS_BUSY ) {
+    //... other work here
+    return;
+  }
+  for( byte kx=0; kx<nsna; kx++ ) {
+    if( ows.run( readPad, sna[kx], pad ) == OWS_DONE ) {
+      Serial.print( ( (int)pad[1]<<8 ) + pad[0] );
+    } else {
+      Serial.print( "err" );
+    }
+    Serial.print( ' ' );
+  }
+  Serial.println( "" );
+  delay( 5000 );
+  ows.start( convertAll, NULL, NULL );
+}
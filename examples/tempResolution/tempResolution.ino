@@ -0,0 +1,62 @@
+//tempResolution - example for DS2482 library thermometer configuration:
+//           - discover the bus into a device table
+//           - set 12 bit resolution on the first sensor, 9 bit on the rest
+//           - convert all sensors and wait only as long as the slowest needs
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised:
+//
+
+#include <Wire.h>
+#include "DS2482.h"       //package of AN3684 subr
+#include "DS2482table.h"  //device table
+#include "DS2482temp.h"   //thermometer configuration
+#include "oneWire.h"      //DS18B20 definitions
+
+#define I2Cadr 0x18       //base address of DS2482
+#define MAXID 8           //maximum number of one-wire devices
+
+DS2482 i2ow( I2Cadr );    //create bridge object on I2C address 0x18
+
+owdevice devs[MAXID];
+DS2482table table( devs, MAXID );
+DS2482temp temps( i2ow, table );
+byte res[MAXID];          //wanted resolution per device
+
+void setup() {
+  Serial.begin( 9600 );
+  while( !Serial ) { /* wait */ }
+  Wire.begin( );
+  i2ow.begin( );
+  Serial.println( "tempResolution - DS2482 bridge" );
+  if( !i2ow.DS2482_detect( ) ) {
+    Serial.print( "error accessing bridge chip at I2Cadr " );
+    Serial.println( I2Cadr, HEX );
+  }
+  table.discover( i2ow );
+
+  for( byte ix=0; ix<MAXID; ix++ ) res[ix] = ( ix == 0 ) ? 12 : 9;
+  int changed = temps.configure( res, 60, -10 );   //TH 60C, TL -10C
+  Serial.print( changed );
+  Serial.println( " sensors written" );
+
+  for( byte ix=0; ix<table.count; ix++ ) {
+    Serial.print( ix );
+    Serial.print( ": " );
+    Serial.print( temps.resolution( ix ) );
+    Serial.print( " bit, " );
+    Serial.print( temps.convTime( ix ) );
+    Serial.println( " ms" );
+  }
+} //setup( )
+
+void loop( ) {
+  i2ow.OWReset( );
+  i2ow.OWWriteByte( CSKRM );
+  i2ow.OWWriteBytePower( CCVRT );
+  delay( temps.maxConvTime( ) );       //not a fixed 750 ms
+  i2ow.OWLevel( MODE_STANDARD );
+  //... read scratchpads as in i2cTemps
+  delay( 5000 );
+}
@@ -0,0 +1,71 @@
+//warmStart - example for DS2482 library device table persistence:
+//           - load the device table saved in EEPROM and start sampling
+//             straight away, or enumerate the bus on a cold start
+//           - finish a rediscovery one device at a time between samples
+//           - report the startup to first sample time
+//
+// started: Oct 19, 2026  DS2482 library contributors
+//
+// revised:
+//
+
+#include <Wire.h>
+#include <EEPROM.h>
+#include "DS2482.h"       //package of AN3684 subr
+#include "DS2482table.h"  //device table
+#include "oneWire.h"      //DS18B20 definitions
+
+#define I2Cadr 0x18       //base address of DS2482
+#define MAXID 16          //maximum number of one-wire devices
+#define TABLEADR 0        //EEPROM address of saved table
+
+DS2482 i2ow( I2Cadr );    //create bridge object on I2C address 0x18
+
+owdevice devs[MAXID];
+DS2482table table( devs, MAXID );
+bool rediscover = false;  //rediscovery pass still to finish
+
+void eeput( uint16_t adr, uint8_t data ) { EEPROM.update( adr, data ); }
+uint8_t eeget( uint16_t adr ) { return EEPROM.read( adr ); }
+
+void sample( ) {
+  i2ow.OWReset( );
+  i2ow.OWWriteByte( CSKRM );
+  i2ow.OWWriteBytePower( CCVRT );
+  delay( 750 );
+  i2ow.OWLevel( MODE_STANDARD );
+  //... read each device in table.dev[ ] as in i2cTemps
+}
+
+void setup() {
+  unsigned long start = millis( );
+  Serial.begin( 9600 );
+  Wire.begin( );
+  i2ow.begin( );
+
+  if( table.warmStart( i2ow, eeget, TABLEADR ) ) {
+    rediscover = true;
+  } else {
+    i2ow.DS2482_detect( );
+    table.discover( i2ow );
+    table.save( eeput, TABLEADR );
+  }
+  unsigned long ready = millis( );
+  sample( );
+
+  while( !Serial ) { /* wait */ }
+  Serial.println( rediscover ? "warm start" : "cold start" );
+  Serial.print( table.count );
+  Serial.println( " devices" );
+  Serial.print( "startup to first sample " );
+  Serial.print( ready - start );
+  Serial.println( " ms" );
+} //setup( )
+
+void loop( ) {
+  if( rediscover ) {
+    rediscover = table.discoverStep( i2ow );   //one device per pass of loop
+    if( !rediscover ) table.save( eeput, TABLEADR );
+  }
+  //... periodic sample( ) calls
+}